@@ -420,9 +420,10 @@ extern int sigsetjmp (sigjmp_buf, int);
             __extension__ \
             ({ \
               sigjmp_buf *_sjbuf = &(env); \
-              ((*_sjbuf)[_SAVEMASK] = savemask,\
-              __SIGMASK_FUNC (SIG_SETMASK, 0, (sigset_t *)((*_sjbuf) + _SIGMASK)),\
-              setjmp (*_sjbuf)); \
+              ((((*_sjbuf)[_SAVEMASK] = savemask) ? \
+               __SIGMASK_FUNC (SIG_SETMASK, 0, (sigset_t *)((*_sjbuf) + _SIGMASK)) \
+               : 0), \
+               setjmp (*_sjbuf)); \
             })
 
 #define siglongjmp(env, val) \
@@ -437,8 +438,8 @@ extern int sigsetjmp (sigjmp_buf, int);
 
 #else /* !__GNUC__ */
 
-#define sigsetjmp(env, savemask) ((env)[_SAVEMASK] = savemask,\
-               __SIGMASK_FUNC (SIG_SETMASK, 0, (sigset_t *) ((env) + _SIGMASK)),\
+#define sigsetjmp(env, savemask) ((((env)[_SAVEMASK] = savemask)?\
+               __SIGMASK_FUNC (SIG_SETMASK, 0, (sigset_t *) ((env) + _SIGMASK)):0),\
                setjmp (env))
 
 #define siglongjmp(env, val) ((((env)[_SAVEMASK])?\
@@ -448,14 +449,15 @@ extern int sigsetjmp (sigjmp_buf, int);
 #endif
 
 /* POSIX _setjmp/_longjmp, maintained for XSI compatibility.  These
-   are equivalent to sigsetjmp/siglongjmp when not saving the signal mask.
-   New applications should use sigsetjmp/siglongjmp instead. */
+   are equivalent to sigsetjmp/siglongjmp when not saving the signal mask,
+   so they never touch it.  New applications should use
+   sigsetjmp/siglongjmp instead. */
 #ifdef __CYGWIN__
 extern void _longjmp (jmp_buf, int) __attribute__ ((__noreturn__));
 extern int _setjmp (jmp_buf);
 #else
-#define _setjmp(env)		sigsetjmp ((env), 0)
-#define _longjmp(env, val)	siglongjmp ((env), (val))
+#define _setjmp(env)		setjmp (env)
+#define _longjmp(env, val)	longjmp ((env), (val))
 #endif
 
 #ifdef __cplusplus
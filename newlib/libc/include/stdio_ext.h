@@ -22,6 +22,24 @@ _BEGIN_STD_C
 void	 __fpurge (FILE *);
 int	 __fsetlocking (FILE *, int);
 
+#ifdef _WANT_STDIO_STATS
+
+/* Operations reported to the function installed by __fsettrace.  */
+#define	__FTRACE_READ		1
+#define	__FTRACE_WRITE		2
+#define	__FTRACE_SEEK		3
+
+typedef void __ftrace_t (FILE *, int, __int64_t, int, __int64_t);
+
+int	 __fstats (FILE *, struct __sstats *);
+void	 __fstats_reset (FILE *);
+int	 __fwalk_stats (int (*)(FILE *, const struct __sstats *, void *),
+			void *);
+int	 __fdump_stats (FILE *);
+__ftrace_t *__fsettrace (__ftrace_t *);
+
+#endif /* _WANT_STDIO_STATS */
+
 /* TODO:
 
    void _flushlbf (void);
@@ -0,0 +1,95 @@
+/* Static tracepoints for newlib internals.
+
+   When newlib is configured with --enable-newlib-tracepoints, each
+   __TRACEPOINTn (name, ...) site assembles to a single nop and records
+   an ELF note in the .note.stapsdt section in the format defined by
+   SystemTap's <sys/sdt.h>.  The note names the probe "newlib:name" and
+   describes where each argument lives at the nop (register, memory
+   operand or constant), so that perf, bpftrace, SystemTap and gdb can
+   place a probe there and read the arguments without debug information
+   and without rebuilding the library.
+
+   Otherwise, and on targets which are not ELF, the macros expand to
+   nothing.  Arguments are passed as long, which is wide enough for
+   sizes, pointers and file descriptors on every ELF target newlib
+   supports.  */
+
+#ifndef _SYS__TRACEPOINT_H_
+#define _SYS__TRACEPOINT_H_
+
+#include <newlib.h>
+
+#if defined (_WANT_TRACEPOINTS) && defined (__ELF__) && defined (__GNUC__)
+
+#define __TRACEPOINTS_ENABLED 1
+
+#if defined (__LP64__) || defined (_LP64)
+#define __TP_ADDR	".8byte"
+#else
+#define __TP_ADDR	".4byte"
+#endif
+
+/* How an argument may be encoded in the note: a constant, a memory
+   operand or a register, subject to what each assembler can print in a
+   form the tracing tools parse.  */
+#if defined (__powerpc__)
+#define __TP_CONSTRAINT	"nZr"
+#elif defined (__arm__)
+#define __TP_CONSTRAINT	"g"
+#else
+#define __TP_CONSTRAINT	"nor"
+#endif
+
+/* "-N@OPERAND": a signed argument N bytes wide.  %n prints the negated
+   value of the size operand.  */
+#define __TP_ARG(n)	"%n[__tp_s" #n "]@%[__tp_a" #n "]"
+#define __TP_OP(n, x)	[__tp_s##n] "n" ((int) sizeof (long)), \
+			[__tp_a##n] __TP_CONSTRAINT ((long) (x))
+
+#define __TP_ASM(name, args) \
+  "990:\tnop\n" \
+  "\t.pushsection .note.stapsdt,\"?\",\"note\"\n" \
+  "\t.balign 4\n" \
+  "\t.4byte 992f-991f,994f-993f,3\n" \
+  "991:\t.asciz \"stapsdt\"\n" \
+  "992:\t.balign 4\n" \
+  "993:\t" __TP_ADDR " 990b\n" \
+  "\t" __TP_ADDR " _.stapsdt.base\n" \
+  "\t" __TP_ADDR " 0\n" \
+  "\t.asciz \"newlib\"\n" \
+  "\t.asciz \"" #name "\"\n" \
+  "\t.asciz \"" args "\"\n" \
+  "994:\t.balign 4\n" \
+  "\t.popsection\n" \
+  "\t.ifndef _.stapsdt.base\n" \
+  "\t.pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+  "\t.weak _.stapsdt.base\n" \
+  "\t.hidden _.stapsdt.base\n" \
+  "_.stapsdt.base:\t.space 1\n" \
+  "\t.size _.stapsdt.base,1\n" \
+  "\t.popsection\n" \
+  "\t.endif\n"
+
+#define __TRACEPOINT0(name) \
+  __asm__ __volatile__ (__TP_ASM (name, ""))
+#define __TRACEPOINT1(name, a1) \
+  __asm__ __volatile__ (__TP_ASM (name, __TP_ARG (1)) \
+			:: __TP_OP (1, a1))
+#define __TRACEPOINT2(name, a1, a2) \
+  __asm__ __volatile__ (__TP_ASM (name, __TP_ARG (1) " " __TP_ARG (2)) \
+			:: __TP_OP (1, a1), __TP_OP (2, a2))
+#define __TRACEPOINT3(name, a1, a2, a3) \
+  __asm__ __volatile__ (__TP_ASM (name, __TP_ARG (1) " " __TP_ARG (2) \
+				  " " __TP_ARG (3)) \
+			:: __TP_OP (1, a1), __TP_OP (2, a2), __TP_OP (3, a3))
+
+#else /* !_WANT_TRACEPOINTS || !__ELF__ || !__GNUC__ */
+
+#define __TRACEPOINT0(name)			((void) 0)
+#define __TRACEPOINT1(name, a1)			((void) 0)
+#define __TRACEPOINT2(name, a1, a2)		((void) 0)
+#define __TRACEPOINT3(name, a1, a2, a3)		((void) 0)
+
+#endif /* _WANT_TRACEPOINTS && __ELF__ && __GNUC__ */
+
+#endif /* _SYS__TRACEPOINT_H_ */
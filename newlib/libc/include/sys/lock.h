@@ -5,6 +5,7 @@
 
 #include <newlib.h>
 #include <_ansi.h>
+#include <sys/_tracepoint.h>
 
 #if !defined(_RETARGETABLE_LOCKING)
 
@@ -47,14 +48,29 @@ extern void __retarget_lock_close(_LOCK_T lock);
 extern void __retarget_lock_close_recursive(_LOCK_T lock);
 #define __lock_close_recursive(lock) __retarget_lock_close_recursive(lock)
 extern void __retarget_lock_acquire(_LOCK_T lock);
-#define __lock_acquire(lock) __retarget_lock_acquire(lock)
 extern void __retarget_lock_acquire_recursive(_LOCK_T lock);
-#define __lock_acquire_recursive(lock) __retarget_lock_acquire_recursive(lock)
 extern int __retarget_lock_try_acquire(_LOCK_T lock);
 #define __lock_try_acquire(lock) __retarget_lock_try_acquire(lock)
 extern int __retarget_lock_try_acquire_recursive(_LOCK_T lock);
 #define __lock_try_acquire_recursive(lock) \
   __retarget_lock_try_acquire_recursive(lock)
+#ifdef __TRACEPOINTS_ENABLED
+/* Try the lock first so that waiting for a lock held by another thread
+   shows up as a lock_contended/lock_acquired pair of tracepoints.  */
+#define __lock_acquire(lock) \
+  __extension__ ({ if (!__retarget_lock_try_acquire(lock)) \
+	{ __TRACEPOINT1(lock_contended, lock); \
+	  __retarget_lock_acquire(lock); \
+	  __TRACEPOINT1(lock_acquired, lock); } })
+#define __lock_acquire_recursive(lock) \
+  __extension__ ({ if (!__retarget_lock_try_acquire_recursive(lock)) \
+	{ __TRACEPOINT1(lock_contended, lock); \
+	  __retarget_lock_acquire_recursive(lock); \
+	  __TRACEPOINT1(lock_acquired, lock); } })
+#else
+#define __lock_acquire(lock) __retarget_lock_acquire(lock)
+#define __lock_acquire_recursive(lock) __retarget_lock_acquire_recursive(lock)
+#endif
 extern void __retarget_lock_release(_LOCK_T lock);
 #define __lock_release(lock) __retarget_lock_release(lock)
 extern void __retarget_lock_release_recursive(_LOCK_T lock);
@@ -178,6 +178,18 @@ extern void   __sinit (struct _reent *);
 # define _REENT_SMALL_CHECK_INIT(ptr) /* nothing */
 #endif /* _REENT_SMALL && !_REENT_GLOBAL_STDIO_STREAMS */
 
+#ifdef _WANT_STDIO_STATS
+/* Per-stream I/O statistics, maintained by stdio and read via __fstats. */
+struct __sstats {
+  __uint64_t _nread;		/* bytes returned by the read function */
+  __uint64_t _nwritten;		/* bytes accepted by the write function */
+  unsigned long _nflush;	/* calls to __sflush_r */
+  unsigned long _nrefill;	/* calls to __srefill_r */
+  unsigned long _nsyscall;	/* read, write and seek calls issued */
+  unsigned long _nbufmode;	/* buffering mode changes (setvbuf) */
+};
+#endif
+
 struct __sFILE {
   unsigned char *_p;	/* current position in (some) buffer */
   int	_r;		/* read space left for getc() */
@@ -227,6 +239,9 @@ struct __sFILE {
 #endif
   _mbstate_t _mbstate;	/* for wide char stdio functions. */
   int   _flags2;        /* for future use */
+#ifdef _WANT_STDIO_STATS
+  struct __sstats _stats;	/* I/O statistics */
+#endif
 };
 
 #ifdef __CUSTOM_FILE_IO__
@@ -281,6 +296,9 @@ struct __sFILE64 {
   _flock_t _lock;	/* for thread-safety locking */
 #endif
   _mbstate_t _mbstate;	/* for wide char stdio functions. */
+#ifdef _WANT_STDIO_STATS
+  struct __sstats _stats;	/* I/O statistics */
+#endif
 };
 typedef struct __sFILE64 __FILE;
 #else
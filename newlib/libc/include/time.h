@@ -92,10 +92,25 @@ char      *strptime (const char *__restrict,
 				 const char *__restrict,
 				 struct tm *__restrict);
 #endif
+#if __BSD_VISIBLE
+time_t	   timegm (struct tm *);
+#endif
 #if __GNU_VISIBLE
 char *strptime_l (const char *__restrict, const char *__restrict,
 		  struct tm *__restrict, locale_t);
 #endif
+#if __MISC_VISIBLE && !defined (__CYGWIN__)
+/* A format compiled once for repeated strptime_exec calls.  Names and
+   the %c, %r, %x and %X formats come from the locale current when it is
+   compiled, which must stay valid until strptime_free.  Cygwin has its
+   own strptime and doesn't provide these.  */
+typedef struct __strptime *strptime_t;
+
+strptime_t strptime_compile (const char *);
+char	  *strptime_exec (strptime_t, const char *__restrict,
+			  struct tm *__restrict);
+void	   strptime_free (strptime_t);
+#endif
 
 #if __POSIX_VISIBLE
 void      tzset 	(void);
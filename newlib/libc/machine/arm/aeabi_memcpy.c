@@ -45,6 +45,13 @@
 
 /* Defined in aeabi_memcpy-armv7a.S.  */
 
+/* NOTE: This ifdef MUST match the chain in memcpy.S.  */
+#elif !(defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)) \
+	&& defined (__ARM_FEATURE_MVE)
+
+/* memcpy uses the MVE vector registers; __aeabi_memcpy and its
+   aliases are defined in memcpy-mve.S.  */
+
 #else
 /* Support the alias for the __aeabi_memcpy which may
    assume memory alignment.  */
@@ -31,6 +31,8 @@
 
 #if defined (__ARM_NEON__) || defined (__ARM_NEON)
 /* Defined in memchr.S.  */
+#elif defined (__ARM_FEATURE_MVE)
+/* Defined in memchr.S.  */
 #elif __ARM_ARCH_ISA_THUMB >= 2 && defined (__ARM_FEATURE_DSP)
 /* Defined in memchr.S.  */
 #else
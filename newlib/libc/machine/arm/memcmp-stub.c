@@ -0,0 +1,12 @@
+/* The structure of the following #if #else #endif conditional chain
+   must match the chain in memcmp.S.  */
+
+#include "acle-compat.h"
+
+#if (defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED))
+# include "../../string/memcmp.c"
+#elif defined (__ARM_FEATURE_MVE)
+/* Defined in memcmp.S.  */
+#else
+# include "../../string/memcmp.c"
+#endif
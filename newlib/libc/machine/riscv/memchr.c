@@ -0,0 +1,8 @@
+/* memchr for RISC-V: the vector version is in memchr-rvv.S, otherwise
+   use the generic one.  */
+
+#if defined (__riscv_vector)
+/* See memchr-rvv.S  */
+#else
+# include "../../string/memchr.c"
+#endif
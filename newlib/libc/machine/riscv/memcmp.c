@@ -0,0 +1,8 @@
+/* memcmp for RISC-V: the vector version is in memcmp-rvv.S, otherwise
+   use the generic one.  */
+
+#if defined (__riscv_vector)
+/* See memcmp-rvv.S  */
+#else
+# include "../../string/memcmp.c"
+#endif
@@ -9,6 +9,9 @@
    http://www.opensource.org/licenses.
 */
 
+#if defined (__riscv_vector)
+/* See memcpy-rvv.S  */
+#else
 #include <string.h>
 #include <stdint.h>
 
@@ -79,3 +82,4 @@ small:
     goto small;
   return aa;
 }
+#endif /* !__riscv_vector */
@@ -0,0 +1,8 @@
+/* strchr for RISC-V: the vector version is in strchr-rvv.S, otherwise
+   use the generic one.  */
+
+#if defined (__riscv_vector)
+/* See strchr-rvv.S  */
+#else
+# include "../../string/strchr.c"
+#endif
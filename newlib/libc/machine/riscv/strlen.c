@@ -9,6 +9,9 @@
    http://www.opensource.org/licenses.
 */
 
+#if defined (__riscv_vector)
+/* See strlen-rvv.S  */
+#else
 #include <string.h>
 #include <stdint.h>
 
@@ -51,3 +54,4 @@ size_t strlen(const char *str)
   return ret + 7 - sl;
 #endif /* not PREFER_SIZE_OVER_SPEED */
 }
+#endif /* !__riscv_vector */
@@ -55,6 +55,7 @@ int	 __get_page(HTAB *, char *, __uint32_t, int, int, int);
 int	 __ibitmap(HTAB *, int, int, int);
 __uint32_t	 __log2(__uint32_t);
 int	 __put_page(HTAB *, char *, __uint32_t, int, int);
+int	 __put_pages(HTAB *, PAGEREF *, int);
 void	 __reclaim_buf(HTAB *, BUFHEAD *);
 int	 __split_page(HTAB *, __uint32_t, __uint32_t);
 
@@ -42,6 +42,14 @@ static char sccsid[] = "@(#)hash.c	8.9 (Berkeley) 6/16/94";
 #include <sys/types.h>
 
 #include <sys/stat.h>
+/* Read-only tables are mapped on systems known to have a working mmap.
+   This is not HAVE_MMAP, which also switches malloc over to mmap.  */
+#if defined(__linux__) || defined(__CYGWIN__)
+#define HASH_MMAP
+#endif
+#ifdef HASH_MMAP
+#include <sys/mman.h>
+#endif
 
 #include <errno.h>
 #include <fcntl.h>
@@ -73,6 +81,9 @@ static int   hash_sync(const DB *, u_int);
 static int   hdestroy(HTAB *);
 static HTAB *init_hash(HTAB *, const char *, const HASHINFO *);
 static int   init_htab(HTAB *, int);
+#ifdef HASH_MMAP
+static void  map_file(HTAB *);
+#endif
 #if (BYTE_ORDER == LITTLE_ENDIAN)
 static void  swap_header(HTAB *);
 static void  swap_header_copy(HASHHDR *, HASHHDR *);
@@ -214,6 +225,10 @@ __hash_open (const char *file,
 
 		hashp->nmaps = bpages;
 		(void)memset(&hashp->mapp[0], 0, bpages * sizeof(__uint32_t *));
+#ifdef HASH_MMAP
+		if ((flags & O_ACCMODE) == O_RDONLY)
+			map_file(hashp);
+#endif
 	}
 
 	/* Initialize Buffer Manager */
@@ -424,6 +439,37 @@ init_htab(hashp, nelem)
 	return (alloc_segs(hashp, nsegs));
 }
 
+#ifdef HASH_MMAP
+/*
+ * Map a table opened read-only, so that pages missing from the buffer
+ * pool are copied out of memory instead of costing a seek and a read
+ * each.  If the file cannot be mapped, pages are read as usual.
+ */
+static void
+map_file(hashp)
+	HTAB *hashp;
+{
+#ifdef __USE_INTERNAL_STAT64
+	struct stat64 statbuf;
+
+	if (_fstat64(hashp->fp, &statbuf) == -1)
+#else
+	struct stat statbuf;
+
+	if (fstat(hashp->fp, &statbuf) == -1)
+#endif
+		return;
+	if (statbuf.st_size <= 0 || statbuf.st_size != (size_t)statbuf.st_size)
+		return;
+	hashp->map = mmap(NULL, (size_t)statbuf.st_size, PROT_READ,
+	    MAP_SHARED, hashp->fp, (off_t)0);
+	if (hashp->map == MAP_FAILED)
+		hashp->map = NULL;
+	else
+		hashp->maplen = (size_t)statbuf.st_size;
+}
+#endif
+
 /********************** DESTROY/CLOSE ROUTINES ************************/
 
 /*
@@ -472,6 +518,10 @@ hdestroy(hashp)
 		if (hashp->mapp[i])
 			free(hashp->mapp[i]);
 
+#ifdef HASH_MMAP
+	if (hashp->map)
+		(void)munmap(hashp->map, hashp->maplen);
+#endif
 	if (hashp->fp != -1)
 		(void)close(hashp->fp);
 
@@ -135,8 +135,16 @@ typedef struct htab	 {		/* Memory resident data structure */
 					 * allocate */
 	BUFHEAD 	bufhead;	/* Header of buffer lru list */
 	SEGMENT 	*dir;		/* Hash Bucket directory */
+	char		*map;		/* Read-only mapping of the file */
+	size_t		maplen;		/* Length of the mapping */
 } HTAB;
 
+/* A modified page to be written back by __put_pages */
+typedef struct {
+	__uint32_t	page;		/* Page number in the file */
+	char		*p;		/* Page data */
+} PAGEREF;
+
 /*
  * Constants
  */
@@ -54,6 +54,7 @@ static char sccsid[] = "@(#)hash_buf.c	8.5 (Berkeley) 7/15/94";
  *	__reclaim_buf
  * Internal
  *	newbuf
+ *	buf_writeback
  */
 
 #include <sys/param.h>
@@ -72,6 +73,7 @@ static char sccsid[] = "@(#)hash_buf.c	8.5 (Berkeley) 7/15/94";
 #include "extern.h"
 
 static BUFHEAD *newbuf(HTAB *, __uint32_t, BUFHEAD *);
+static int buf_writeback(HTAB *);
 
 /* Unlink B from its place in the lru */
 #define BUF_REMOVE(B) { \
@@ -330,27 +332,75 @@ __buf_free(hashp, do_free, to_disk)
 	/* Need to make sure that buffer manager has been initialized */
 	if (!LRU)
 		return (0);
-	for (bp = LRU; bp != &hashp->bufhead;) {
-		/* Check that the buffer is valid */
-		if (bp->addr || IS_BUCKET(bp->flags)) {
-			if (to_disk && (bp->flags & BUF_MOD) &&
-			    __put_page(hashp, bp->page,
-			    bp->addr, IS_BUCKET(bp->flags), 0))
-				return (-1);
-		}
-		/* Check if we are freeing stuff */
-		if (do_free) {
+	if (to_disk && buf_writeback(hashp))
+		return (-1);
+	/* Check if we are freeing stuff */
+	if (do_free)
+		while ((bp = LRU) != &hashp->bufhead) {
 			if (bp->page)
 				free(bp->page);
 			BUF_REMOVE(bp);
 			free(bp);
-			bp = LRU;
-		} else
-			bp = bp->prev;
-	}
+		}
 	return (0);
 }
 
+static int
+pageref_cmp(a, b)
+	const void *a, *b;
+{
+	__uint32_t pa, pb;
+
+	pa = ((const PAGEREF *)a)->page;
+	pb = ((const PAGEREF *)b)->page;
+	return (pa < pb ? -1 : pa > pb);
+}
+
+/*
+ * Write every modified buffer to disk.  The pages are sorted into file
+ * order first, so that the writes are sequential and adjacent pages go
+ * out together.  Without memory for the sort, they are written one at a
+ * time in LRU order.
+ */
+static int
+buf_writeback(hashp)
+	HTAB *hashp;
+{
+	BUFHEAD *bp;
+	PAGEREF *pg;
+	int i, n, ret;
+
+	n = 0;
+	for (bp = LRU; bp != &hashp->bufhead; bp = bp->prev)
+		if ((bp->addr || IS_BUCKET(bp->flags)) && (bp->flags & BUF_MOD))
+			n++;
+	if (n == 0)
+		return (0);
+
+	if ((pg = (PAGEREF *)malloc(n * sizeof(PAGEREF))) == NULL) {
+		for (bp = LRU; bp != &hashp->bufhead; bp = bp->prev)
+			if ((bp->addr || IS_BUCKET(bp->flags)) &&
+			    (bp->flags & BUF_MOD) && __put_page(hashp,
+			    bp->page, bp->addr, (int)IS_BUCKET(bp->flags), 0))
+				return (-1);
+		return (0);
+	}
+	i = 0;
+	for (bp = LRU; bp != &hashp->bufhead; bp = bp->prev)
+		if ((bp->addr || IS_BUCKET(bp->flags)) &&
+		    (bp->flags & BUF_MOD)) {
+			if (IS_BUCKET(bp->flags))
+				pg[i].page = BUCKET_TO_PAGE(bp->addr);
+			else
+				pg[i].page = OADDR_TO_PAGE(bp->addr);
+			pg[i++].p = bp->page;
+		}
+	qsort(pg, n, sizeof(PAGEREF), pageref_cmp);
+	ret = __put_pages(hashp, pg, n);
+	free(pg);
+	return (ret);
+}
+
 extern void
 __reclaim_buf(hashp, bp)
 	HTAB *hashp;
@@ -50,6 +50,7 @@ static char sccsid[] = "@(#)hash_page.c	8.7 (Berkeley) 8/16/94";
  *
  * External
  *	__get_page
+ *	__put_pages
  *	__add_ovflpage
  * Internal
  *	overflow_page
@@ -526,6 +527,7 @@ __get_page(hashp, p, bucket, is_bucket, is_disk, is_bitmap)
 	int fd, page, size;
 	int rsize;
 	__uint16_t *bp;
+	off_t off;
 
 	fd = hashp->fp;
 	size = hashp->BSIZE;
@@ -538,7 +540,11 @@ __get_page(hashp, p, bucket, is_bucket, is_disk, is_bitmap)
 		page = BUCKET_TO_PAGE(bucket);
 	else
 		page = OADDR_TO_PAGE(bucket);
-	if ((lseek(fd, (off_t)page << hashp->BSHIFT, SEEK_SET) == -1) ||
+	off = (off_t)page << hashp->BSHIFT;
+	if (hashp->map && off + size <= (off_t)hashp->maplen) {
+		memcpy(p, hashp->map + off, size);
+		rsize = size;
+	} else if ((lseek(fd, off, SEEK_SET) == -1) ||
 	    ((rsize = read(fd, p, size)) == -1))
 		return (-1);
 	bp = (__uint16_t *)p;
@@ -585,16 +591,15 @@ __put_page(hashp, p, bucket, is_bucket, is_bitmap)
 {
 	int fd, page, size;
 	int wsize;
+	int i, max;
 
 	size = hashp->BSIZE;
 	if ((hashp->fp == -1) && open_temp(hashp))
 		return (-1);
 	fd = hashp->fp;
 
-       if (hashp->LORDER != DB_BYTE_ORDER) {
-		int i;
-		int max;
-
+	max = 0;
+	if (hashp->LORDER != DB_BYTE_ORDER) {
 		if (is_bitmap) {
 			max = hashp->BSIZE >> 2;	/* divide by 4 */
 			for (i = 0; i < max; i++)
@@ -611,6 +616,21 @@ __put_page(hashp, p, bucket, is_bucket, is_bitmap)
 		page = OADDR_TO_PAGE(bucket);
 	if ((lseek(fd, (off_t)page << hashp->BSHIFT, SEEK_SET) == -1) ||
 	    ((wsize = write(fd, p, size)) == -1))
+		wsize = -1;
+	/*
+	 * Swap the page back: bitmaps and pages written by hash_sync stay
+	 * in use after this.
+	 */
+	if (hashp->LORDER != DB_BYTE_ORDER) {
+		if (is_bitmap) {
+			for (i = 0; i < max; i++)
+				M_32_SWAP(((int *)p)[i]);
+		} else {
+			for (i = 0; i <= max; i++)
+				M_16_SWAP(((__uint16_t *)p)[i]);
+		}
+	}
+	if (wsize == -1)
 		/* Errno is set */
 		return (-1);
 	if (wsize != size) {
@@ -620,6 +640,65 @@ __put_page(hashp, p, bucket, is_bucket, is_bitmap)
 	return (0);
 }
 
+/*
+ * Write the N pages of PG, sorted by page number, to disk.  Runs of
+ * consecutive pages are gathered into one buffer and written with a
+ * single system call.  Byte swapping is done on the copy, so the pages
+ * in the buffer pool stay usable.
+ *
+ * Returns:
+ *	 0 ==> OK
+ *	-1 ==>failure
+ */
+extern int
+__put_pages(hashp, pg, n)
+	HTAB *hashp;
+	PAGEREF *pg;
+	int n;
+{
+	char *run, *q;
+	int fd, i, j, k, max, maxrun, size, len, wsize;
+
+	size = hashp->BSIZE;
+	if ((hashp->fp == -1) && open_temp(hashp))
+		return (-1);
+	fd = hashp->fp;
+
+	maxrun = DEF_BUFSIZE >> hashp->BSHIFT;
+	if (maxrun < 1)
+		maxrun = 1;
+	if ((run = (char *)malloc(maxrun * size)) == NULL)
+		return (-1);
+
+	for (i = 0; i < n; i = j) {
+		for (j = i + 1; j < n && j - i < maxrun &&
+		    pg[j].page == pg[j - 1].page + 1; j++)
+			;
+		for (k = i, q = run; k < j; k++, q += size) {
+			memcpy(q, pg[k].p, size);
+			if (hashp->LORDER != DB_BYTE_ORDER) {
+				max = ((__uint16_t *)q)[0] + 2;
+				for (len = 0; len <= max; len++)
+					M_16_SWAP(((__uint16_t *)q)[len]);
+			}
+		}
+		len = (j - i) * size;
+		if ((lseek(fd, (off_t)pg[i].page << hashp->BSHIFT,
+		    SEEK_SET) == -1) ||
+		    ((wsize = write(fd, run, len)) == -1)) {
+			free(run);
+			return (-1);
+		}
+		if (wsize != len) {
+			free(run);
+			errno = EFTYPE;
+			return (-1);
+		}
+	}
+	free(run);
+	return (0);
+}
+
 #define BYTE_MASK	((1 << INT_BYTE_SHIFT) -1)
 /*
  * Initialize a new bitmap page.  Bitmap pages are left in memory
@@ -108,6 +108,8 @@ __sflush_r (struct _reent *ptr,
   register _READ_WRITE_RETURN_TYPE t;
   short flags;
 
+  _STDIO_STAT_ADD (fp, _nflush, 1);
+
   flags = fp->_flags;
   if ((flags & __SWR) == 0)
     {
@@ -210,6 +212,7 @@ __sflush_r (struct _reent *ptr,
       return 0;
     }
   n = fp->_p - p;		/* write this much */
+  __TRACEPOINT3 (sflush, fp, fp->_file, n);
 
   /*
    * Set these immediately to avoid problems with longjmp
@@ -58,6 +58,9 @@ std (FILE *ptr,
   ptr->_bf._size = 0;
   ptr->_lbfsize = 0;
   memset (&ptr->_mbstate, 0, sizeof (_mbstate_t));
+#ifdef _WANT_STDIO_STATS
+  memset (&ptr->_stats, 0, sizeof (struct __sstats));
+#endif
   ptr->_cookie = ptr;
   ptr->_read = __sread;
 #ifndef __LARGE64_FILES
@@ -183,6 +186,9 @@ found:
   fp->_bf._size = 0;
   fp->_lbfsize = 0;		/* not line buffered */
   memset (&fp->_mbstate, 0, sizeof (_mbstate_t));
+#ifdef _WANT_STDIO_STATS
+  memset (&fp->_stats, 0, sizeof (struct __sstats));
+#endif
   /* fp->_cookie = <any>; */	/* caller sets cookie, _read/_write etc */
   fp->_ub._base = NULL;		/* no ungetc buffer */
   fp->_ub._size = 0;
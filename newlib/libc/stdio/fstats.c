@@ -0,0 +1,165 @@
+/*
+FUNCTION
+<<__fstats>>, <<__fstats_reset>>, <<__fwalk_stats>>, <<__fdump_stats>>, <<__fsettrace>>---stdio stream I/O statistics
+
+INDEX
+	__fstats
+INDEX
+	__fstats_reset
+INDEX
+	__fwalk_stats
+INDEX
+	__fdump_stats
+INDEX
+	__fsettrace
+
+SYNOPSIS
+	#include <stdio.h>
+	#include <stdio_ext.h>
+	int __fstats(FILE *<[fp]>, struct __sstats *<[st]>);
+	void __fstats_reset(FILE *<[fp]>);
+	int __fwalk_stats(int (*<[fn]>)(FILE *, const struct __sstats *, void *),
+			  void *<[arg]>);
+	int __fdump_stats(FILE *<[out]>);
+	__ftrace_t *__fsettrace(__ftrace_t *<[fn]>);
+
+DESCRIPTION
+When newlib is configured with <<--enable-newlib-stdio-stats>>, every
+stream keeps a <<struct __sstats>> which counts the bytes returned by
+the read function (<<_nread>>) and accepted by the write function
+(<<_nwritten>>), the number of buffer flushes (<<_nflush>>) and refills
+(<<_nrefill>>), the number of read, write and seek calls issued to the
+operating system (<<_nsyscall>>) and the number of buffering mode
+changes through <<setvbuf>> (<<_nbufmode>>).  Comparing <<_nsyscall>>
+with the byte counts shows whether a program is paying for line
+buffering, unbuffered streams or frequent flushes.
+
+<<__fstats>> copies the statistics of <[fp]> to <[st]>.
+<<__fstats_reset>> clears them.
+
+<<__fwalk_stats>> calls <[fn]> for each open stream, passing the stream,
+a snapshot of its statistics and <[arg]>.  The results of <[fn]> are
+or'ed together and returned.
+
+<<__fdump_stats>> writes one line per open stream with its file
+descriptor and statistics to <[out]>.
+
+<<__fsettrace>> installs <[fn]> as trace function, or removes it if
+<[fn]> is <<NULL>>.  The trace function is called after each underlying
+read, write or seek call with the stream, the operation
+(<<__FTRACE_READ>>, <<__FTRACE_WRITE>> or <<__FTRACE_SEEK>>), the
+requested byte count or seek offset, the seek <<whence>> argument (0
+for reads and writes), and the result of the call.  The trace function
+is called with the stream locked and must not do I/O on that stream.
+
+RETURNS
+<<__fstats>> returns 0.  <<__fwalk_stats>> returns the or'ed results of
+<[fn]>.  <<__fdump_stats>> returns 0, or <<EOF>> if writing to <[out]>
+failed.  <<__fsettrace>> returns the previously installed trace
+function.
+
+PORTABILITY
+These functions are newlib extensions.
+
+No supporting OS subroutines are required.
+*/
+
+#include <_ansi.h>
+#include <stdio.h>
+#include <stdio_ext.h>
+#include <string.h>
+#include "local.h"
+
+#ifdef _WANT_STDIO_STATS
+
+int
+__fstats (FILE *fp,
+       struct __sstats *st)
+{
+  CHECK_INIT (_REENT, fp);
+  _newlib_flockfile_start (fp);
+  *st = fp->_stats;
+  _newlib_flockfile_end (fp);
+  return 0;
+}
+
+void
+__fstats_reset (FILE *fp)
+{
+  CHECK_INIT (_REENT, fp);
+  _newlib_flockfile_start (fp);
+  memset (&fp->_stats, 0, sizeof (struct __sstats));
+  _newlib_flockfile_end (fp);
+}
+
+struct walk_arg
+{
+  int (*fn) (FILE *, const struct __sstats *, void *);
+  void *arg;
+};
+
+static int
+walk_one (FILE *fp,
+       void *arg)
+{
+  struct walk_arg *wa = (struct walk_arg *) arg;
+  struct __sstats st;
+
+  __fstats (fp, &st);
+  return (*wa->fn) (fp, &st, wa->arg);
+}
+
+int
+__fwalk_stats (int (*fn) (FILE *, const struct __sstats *, void *),
+       void *arg)
+{
+  struct walk_arg wa;
+
+  wa.fn = fn;
+  wa.arg = arg;
+  return _fwalk_arg (_GLOBAL_REENT, walk_one, &wa);
+}
+
+static int
+dump_one (FILE *fp,
+       const struct __sstats *st,
+       void *arg)
+{
+  FILE *out = (FILE *) arg;
+
+#ifdef _WANT_IO_LONG_LONG
+  return fiprintf (out, "fd %d: read %llu written %llu flush %lu "
+			"refill %lu syscall %lu bufmode %lu\n",
+		   fp->_file, (unsigned long long) st->_nread,
+		   (unsigned long long) st->_nwritten, st->_nflush,
+		   st->_nrefill, st->_nsyscall, st->_nbufmode) < 0;
+#else
+  return fiprintf (out, "fd %d: read %lu written %lu flush %lu "
+			"refill %lu syscall %lu bufmode %lu\n",
+		   fp->_file, (unsigned long) st->_nread,
+		   (unsigned long) st->_nwritten, st->_nflush,
+		   st->_nrefill, st->_nsyscall, st->_nbufmode) < 0;
+#endif
+}
+
+int
+__fdump_stats (FILE *out)
+{
+  /* Flush first so that OUT's own counters are current and no output
+     is pending while we walk the stream list.  */
+  fflush (out);
+  if (__fwalk_stats (dump_one, out))
+    return EOF;
+  return fflush (out);
+}
+
+__ftrace_t *
+__fsettrace (__ftrace_t *fn)
+{
+  __ftrace_t *old = __stdio_trace;
+
+  __stdio_trace = fn;
+  return old;
+}
+
+#endif /* _WANT_STDIO_STATS */
@@ -51,6 +51,27 @@ _fwalk (struct _reent *ptr,
   return ret;
 }
 
+#ifdef _WANT_STDIO_STATS
+/* Version of _fwalk passing an additional argument to the function.  */
+int
+_fwalk_arg (struct _reent *ptr,
+       int (*function) (FILE *, void *),
+       void *arg)
+{
+  register FILE *fp;
+  register int n, ret = 0;
+  register struct _glue *g;
+
+  /* Same locking considerations as in _fwalk apply. */
+  for (g = &ptr->__sglue; g != NULL; g = g->_next)
+    for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
+      if (fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
+	ret |= (*function) (fp, arg);
+
+  return ret;
+}
+#endif /* _WANT_STDIO_STATS */
+
 /* Special version of __fwalk where the function pointer is a reentrant
    I/O function (e.g. _fclose_r).  */
 int
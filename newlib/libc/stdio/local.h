@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <stdio.h>
+#include <sys/_tracepoint.h>
 #ifdef __SCLE
 # include <io.h>
 #endif
@@ -185,6 +186,9 @@ extern void   __smakebuf_r (struct _reent *, FILE *);
 extern int    __swhatbuf_r (struct _reent *, FILE *, size_t *, int *);
 extern int    _fwalk (struct _reent *, int (*)(FILE *));
 extern int    _fwalk_reent (struct _reent *, int (*)(struct _reent *, FILE *));
+#ifdef _WANT_STDIO_STATS
+extern int    _fwalk_arg (struct _reent *, int (*)(FILE *, void *), void *);
+#endif
 struct _glue * __sfmoreglue (struct _reent *,int n);
 extern int __submore (struct _reent *, FILE *);
 
@@ -195,6 +199,31 @@ extern _READ_WRITE_RETURN_TYPE __swrite64 (struct _reent *, void *,
 						  _READ_WRITE_BUFSIZE_TYPE);
 #endif
 
+/* Per-stream statistics and tracing of the low-level I/O calls, enabled
+   with --enable-newlib-stdio-stats.  _STDIO_STAT_ADD adds N to the counter
+   FIELD of the stream's struct __sstats; _STDIO_TRACE calls the trace
+   function installed by __fsettrace, if any.  */
+
+#ifdef _WANT_STDIO_STATS
+#include <stdio_ext.h>
+
+extern __ftrace_t *__stdio_trace;
+
+#define _STDIO_STAT_ADD(fp, field, n)	((fp)->_stats.field += (n))
+#define _STDIO_TRACE(fp, op, arg, whence, ret)				\
+  do									\
+    {									\
+      __ftrace_t *_trace_fn = __stdio_trace;				\
+      if (_trace_fn != NULL)						\
+	(*_trace_fn) ((fp), (op), (__int64_t) (arg), (whence),		\
+		      (__int64_t) (ret));				\
+    }									\
+  while (0)
+#else
+#define _STDIO_STAT_ADD(fp, field, n)	((void) 0)
+#define _STDIO_TRACE(fp, op, arg, whence, ret)	((void) 0)
+#endif /* _WANT_STDIO_STATS */
+
 /* Called by the main entry point fns to ensure stdio has been initialized.  */
 
 #if defined(_REENT_SMALL) && !defined(_REENT_GLOBAL_STDIO_STREAMS)
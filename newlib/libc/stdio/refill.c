@@ -45,6 +45,8 @@ __srefill_r (struct _reent * ptr,
 
   ORIENT (fp, -1);
 
+  _STDIO_STAT_ADD (fp, _nrefill, 1);
+
   fp->_r = 0;			/* largely a convenience for callers */
 
 #ifndef __CYGWIN__
@@ -115,6 +117,7 @@ __srefill_r (struct _reent * ptr,
 
   fp->_p = fp->_bf._base;
   fp->_r = fp->_read (ptr, fp->_cookie, (char *) fp->_p, fp->_bf._size);
+  __TRACEPOINT3 (srefill, fp, fp->_file, fp->_r);
 #ifndef __CYGWIN__
   if (fp->_r <= 0)
 #else
@@ -117,6 +117,7 @@ setvbuf (register FILE * fp,
    * non buffer flags, and clear malloc flag.
    */
   _newlib_flockfile_start (fp);
+  _STDIO_STAT_ADD (fp, _nbufmode, 1);
   _fflush_r (reent, fp);
   if (HASUB(fp))
     FREEUB(reent, fp);
@@ -24,6 +24,11 @@
 #include <sys/unistd.h>
 #include "local.h"
 
+#ifdef _WANT_STDIO_STATS
+/* Trace function called on each read, write and seek, see __fsettrace. */
+__ftrace_t *__stdio_trace;
+#endif
+
 /*
  * Small standard I/O/seek/close functions.
  * These maintain the `known seek offset' for seek optimisation.
@@ -51,6 +56,11 @@ __sread (struct _reent *ptr,
     setmode (fp->_file, oldmode);
 #endif
 
+  _STDIO_STAT_ADD (fp, _nsyscall, 1);
+  if (ret > 0)
+    _STDIO_STAT_ADD (fp, _nread, ret);
+  _STDIO_TRACE (fp, __FTRACE_READ, n, 0, ret);
+
   /* If the read succeeded, update the current offset.  */
 
   if (ret >= 0)
@@ -83,7 +93,13 @@ __swrite (struct _reent *ptr,
 #endif
 
   if (fp->_flags & __SAPP)
-    _lseek_r (ptr, fp->_file, (_off_t) 0, SEEK_END);
+    {
+      _off_t pos = _lseek_r (ptr, fp->_file, (_off_t) 0, SEEK_END);
+
+      _STDIO_STAT_ADD (fp, _nsyscall, 1);
+      _STDIO_TRACE (fp, __FTRACE_SEEK, 0, SEEK_END, pos);
+      (void) pos;
+    }
   fp->_flags &= ~__SOFF;	/* in case O_APPEND mode is set */
 
 #ifdef __SCLE
@@ -98,6 +114,11 @@ __swrite (struct _reent *ptr,
     setmode (fp->_file, oldmode);
 #endif
 
+  _STDIO_STAT_ADD (fp, _nsyscall, 1);
+  if (w > 0)
+    _STDIO_STAT_ADD (fp, _nwritten, w);
+  _STDIO_TRACE (fp, __FTRACE_WRITE, n, 0, w);
+
   return w;
 }
 
@@ -111,6 +132,8 @@ __sseek (struct _reent *ptr,
   register _off_t ret;
 
   ret = _lseek_r (ptr, fp->_file, (_off_t) offset, whence);
+  _STDIO_STAT_ADD (fp, _nsyscall, 1);
+  _STDIO_TRACE (fp, __FTRACE_SEEK, offset, whence, ret);
   if (ret == -1L)
     fp->_flags &= ~__SOFF;
   else
@@ -365,6 +365,76 @@ int __ssprint_r (struct _reent *, FILE *, register struct __suio *);
 #else /* !STRING_ONLY */
 #ifdef INTEGER_ONLY
 
+#ifdef _WIDE_ORIENT
+/*
+ * Write LEN wide characters to the wide-oriented stream FP, converting
+ * them as _fputwc_r would.  The caller holds the stream lock.  Runs of
+ * characters that encode as themselves are copied straight into a
+ * local buffer, the rest go through _wcrtomb_r, and each full buffer
+ * is handed to __sfvwrite_r in one go.
+ */
+static int
+__sfputws_r (struct _reent *ptr,
+       FILE *fp,
+       const wchar_t *p,
+       size_t len)
+{
+	char buf[BUFSIZ];
+	struct __suio uio;
+	struct __siov iov;
+	size_t i, k, n;
+	__uint32_t lim, single;
+	int err = 0;
+
+	/* Like __fputwc, a single-byte locale writes 1..UCHAR_MAX as is. */
+	single = MB_CUR_MAX == 1 ? UCHAR_MAX : 0;
+	uio.uio_iov = &iov;
+	uio.uio_iovcnt = 1;
+	iov.iov_base = buf;
+	while (len > 0) {
+		n = 0;
+		while (len > 0 && n <= sizeof (buf) - MB_LEN_MAX) {
+			lim = single;
+#ifdef _MB_CAPABLE
+			/* So does ASCII in UTF-8, unless half a surrogate
+			   pair is pending. */
+			if (!lim && fp->_mbstate.__count == 0
+			    && __WCTOMB == __utf8_wctomb)
+				lim = 0x7f;
+#endif
+			/* Stopping short of K leaves room for one more
+			   converted character. */
+			k = sizeof (buf) - MB_LEN_MAX - n + 1;
+			if (k > len)
+				k = len;
+			for (i = 0; i < k && (__uint32_t) p[i] - 1 < lim; i++)
+				buf[n + i] = (char) p[i];
+			n += i;
+			p += i;
+			len -= i;
+			if (i == k)
+				continue;
+			k = _wcrtomb_r (ptr, buf + n, *p, &fp->_mbstate);
+			if (k == (size_t) -1) {
+				fp->_flags |= __SERR;
+				err = -1;
+				len = 0;
+				break;
+			}
+			n += k;
+			p++;
+			len--;
+		}
+		if (n > 0) {
+			iov.iov_len = uio.uio_resid = n;
+			if (__sfvwrite_r (ptr, fp, &uio))
+				return -1;
+		}
+	}
+	return err;
+}
+#endif
+
 #ifndef _FVWRITE_IN_STREAMIO
 int
 __sfputs_r (struct _reent *ptr,
@@ -376,13 +446,9 @@ __sfputs_r (struct _reent *ptr,
 
 #ifdef _WIDE_ORIENT
 	if (fp->_flags2 & __SWID) {
-		wchar_t *p;
-
-		p = (wchar_t *) buf;
-		for (i = 0; i < (len / sizeof (wchar_t)); i++) {
-			if (_fputwc_r (ptr, p[i], fp) == WEOF)
-				return -1;
-		}
+		if (__sfputws_r (ptr, fp, (const wchar_t *) buf,
+				 len / sizeof (wchar_t)))
+			return -1;
 	} else {
 #else
 	{
@@ -413,19 +479,16 @@ __sprint_r (struct _reent *ptr,
 #ifdef _WIDE_ORIENT
 	if (fp->_flags2 & __SWID) {
 		struct __siov *iov;
-		wchar_t *p;
-		int i, len;
+		int len;
 
 		iov = uio->uio_iov;
 		for (; uio->uio_resid != 0;
 		     uio->uio_resid -= len * sizeof (wchar_t), iov++) {
-			p = (wchar_t *) iov->iov_base;
 			len = iov->iov_len / sizeof (wchar_t);
-			for (i = 0; i < len; i++) {
-				if (_fputwc_r (ptr, p[i], fp) == WEOF) {
-					err = -1;
-					goto out;
-				}
+			if (__sfputws_r (ptr, fp, (const wchar_t *) iov->iov_base,
+					 len)) {
+				err = -1;
+				goto out;
 			}
 		}
 	} else
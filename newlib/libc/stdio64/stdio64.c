@@ -35,6 +35,8 @@ __sseek64 (struct _reent *ptr,
   register _off64_t ret;
 
   ret = _lseek64_r (ptr, fp->_file, (_off64_t) offset, whence);
+  _STDIO_STAT_ADD (fp, _nsyscall, 1);
+  _STDIO_TRACE (fp, __FTRACE_SEEK, offset, whence, ret);
   if (ret == (_fpos64_t)-1L)
     fp->_flags &= ~__SOFF;
   else
@@ -58,7 +60,13 @@ __swrite64 (struct _reent *ptr,
 #endif
 
   if (fp->_flags & __SAPP)
-    (void) _lseek64_r (ptr, fp->_file, (_off64_t)0, SEEK_END);
+    {
+      _off64_t pos = _lseek64_r (ptr, fp->_file, (_off64_t)0, SEEK_END);
+
+      _STDIO_STAT_ADD (fp, _nsyscall, 1);
+      _STDIO_TRACE (fp, __FTRACE_SEEK, 0, SEEK_END, pos);
+      (void) pos;
+    }
   fp->_flags &= ~__SOFF;	/* in case O_APPEND mode is set */
 
 #ifdef __SCLE
@@ -73,6 +81,11 @@ __swrite64 (struct _reent *ptr,
     setmode(fp->_file, oldmode);
 #endif
 
+  _STDIO_STAT_ADD (fp, _nsyscall, 1);
+  if (w > 0)
+    _STDIO_STAT_ADD (fp, _nwritten, w);
+  _STDIO_TRACE (fp, __FTRACE_WRITE, n, 0, w);
+
   return w;
 }
 
@@ -38,8 +38,9 @@
 #include <sys/lock.h>
 #include "atexit.h"
 
-/* Make this a weak reference to avoid pulling in malloc.  */
+/* Make these weak references to avoid pulling in malloc.  */
 void * malloc(size_t) _ATTRIBUTE((__weak__));
+void free(void *) _ATTRIBUTE((__weak__));
 
 #ifdef _LITE_EXIT
 /* As __call_exitprocs is weak reference in lite exit, make a
@@ -58,6 +59,201 @@ static struct _atexit _global_atexit0 = _ATEXIT_INIT;
 # define _GLOBAL_ATEXIT0 (&_GLOBAL_REENT->_atexit0)
 #endif
 
+#ifdef _ATEXIT_DYNAMIC_ALLOC
+
+/*
+ * __cxa_finalize must call the handlers of one DSO, most recent first.
+ * Instead of scanning every registered handler for each DSO, keep for
+ * each DSO handle a stack of the slots (block and index) holding its
+ * handlers.  Whether called by exit or by __cxa_finalize, handlers run
+ * most recent first, so the slot being released is normally the top of
+ * its stack and both registration and release take constant time.
+ *
+ * If memory for the index runs out, it is dropped and __cxa_finalize
+ * falls back to scanning all handlers.  All of this is protected by
+ * __atexit_recursive_mutex.
+ */
+
+struct _atexit_slot {
+  struct _atexit *p;
+  int n;
+};
+
+struct _atexit_dso {
+  struct _atexit_dso *next;		/* next in hash chain */
+  void *d;				/* DSO handle */
+  int nslots;				/* slots in use */
+  int size;				/* slots allocated */
+  struct _atexit_slot *slots;		/* oldest first */
+};
+
+#define DSO_HASH_BITS	6
+#define DSO_HASH_SIZE	(1 << DSO_HASH_BITS)
+
+static struct _atexit_dso *dso_hash[DSO_HASH_SIZE];
+static int dso_failed;
+
+static struct _atexit_dso **
+dso_bucket (void *d)
+{
+  unsigned int h = (unsigned int) ((__uintptr_t) d >> 3) * 2654435761U;
+
+  return &dso_hash[h >> (32 - DSO_HASH_BITS)];
+}
+
+static struct _atexit_dso *
+dso_find (void *d)
+{
+  struct _atexit_dso *dso;
+
+  for (dso = *dso_bucket (d); dso != NULL; dso = dso->next)
+    if (dso->d == d)
+      break;
+  return dso;
+}
+
+/* Give up on the index, see above.  */
+
+static void
+dso_fail (void)
+{
+  struct _atexit_dso *dso, *next;
+  int i;
+
+  dso_failed = 1;
+  if (!free)
+    return;
+  for (i = 0; i < DSO_HASH_SIZE; i++)
+    {
+      for (dso = dso_hash[i]; dso != NULL; dso = next)
+	{
+	  next = dso->next;
+	  free (dso->slots);
+	  free (dso);
+	}
+      dso_hash[i] = NULL;
+    }
+}
+
+/* Record that slot N of block P holds a handler of DSO D.  */
+
+static void
+dso_push (void *d, struct _atexit *p, int n)
+{
+  struct _atexit_dso *dso;
+  struct _atexit_slot *slots;
+  int i;
+
+  if (dso_failed)
+    return;
+  if (!malloc || !free)
+    {
+      dso_failed = 1;
+      return;
+    }
+
+  dso = dso_find (d);
+  if (dso == NULL)
+    {
+      struct _atexit_dso **bucket = dso_bucket (d);
+
+      dso = (struct _atexit_dso *) malloc (sizeof *dso);
+      if (dso == NULL)
+	{
+	  dso_fail ();
+	  return;
+	}
+      dso->d = d;
+      dso->nslots = 0;
+      dso->size = 0;
+      dso->slots = NULL;
+      dso->next = *bucket;
+      *bucket = dso;
+    }
+
+  if (dso->nslots == dso->size)
+    {
+      slots = (struct _atexit_slot *)
+	malloc ((dso->size ? 2 * dso->size : 8) * sizeof *slots);
+      if (slots == NULL)
+	{
+	  dso_fail ();
+	  return;
+	}
+      for (i = 0; i < dso->nslots; i++)
+	slots[i] = dso->slots[i];
+      free (dso->slots);
+      dso->slots = slots;
+      dso->size = dso->size ? 2 * dso->size : 8;
+    }
+
+  dso->slots[dso->nslots].p = p;
+  dso->slots[dso->nslots].n = n;
+  dso->nslots++;
+}
+
+/*
+ * Return in *PP and *NP the slot of the most recently registered
+ * handler of DSO D.  Return 1 if there is one, 0 if there is none and -1
+ * if the index is not available.
+ */
+
+int
+__atexit_dso_top (void *d,
+	struct _atexit **pp,
+	int *np)
+{
+  struct _atexit_dso *dso;
+
+  if (dso_failed)
+    return -1;
+  dso = dso_find (d);
+  if (dso == NULL)
+    return 0;
+  *pp = dso->slots[dso->nslots - 1].p;
+  *np = dso->slots[dso->nslots - 1].n;
+  return 1;
+}
+
+/*
+ * Forget that slot N of block P holds a handler of DSO D, because the
+ * handler is about to be called.
+ */
+
+void
+__atexit_dso_pop (void *d,
+	struct _atexit *p,
+	int n)
+{
+  struct _atexit_dso *dso, **prev;
+  int i;
+
+  if (dso_failed)
+    return;
+  for (prev = dso_bucket (d); (dso = *prev) != NULL; prev = &dso->next)
+    if (dso->d == d)
+      break;
+  if (dso == NULL)
+    return;
+
+  for (i = dso->nslots - 1; i >= 0; i--)
+    if (dso->slots[i].p == p && dso->slots[i].n == n)
+      break;
+  if (i < 0)
+    return;
+  for (dso->nslots--; i < dso->nslots; i++)
+    dso->slots[i] = dso->slots[i + 1];
+
+  if (dso->nslots == 0)
+    {
+      *prev = dso->next;
+      free (dso->slots);
+      free (dso);
+    }
+}
+
+#endif /* _ATEXIT_DYNAMIC_ALLOC */
+
 /*
  * Register a function to be performed at exit or on shared library unload.
  */
@@ -158,6 +354,28 @@ __register_exitproc (int type,
       args->_dso_handle[p->_ind] = d;
       if (type == __et_cxa)
 	args->_is_cxa |= (1 << p->_ind);
+      else
+	args->_is_cxa &= ~(1 << p->_ind);
+#ifdef _ATEXIT_DYNAMIC_ALLOC
+      if (d != NULL)
+	dso_push (d, p, p->_ind);
+#endif
+    }
+  else
+    {
+      /* The slot may have held an on_exit or __cxa_atexit handler
+	 before.  */
+#ifdef _REENT_SMALL
+      args = p->_on_exit_args_ptr;
+      if (args != NULL)
+#else
+      args = &p->_on_exit_args;
+#endif
+	{
+	  args->_fntypes &= ~(1 << p->_ind);
+	  args->_is_cxa &= ~(1 << p->_ind);
+	  args->_dso_handle[p->_ind] = NULL;
+	}
     }
   p->_fns[p->_ind++] = fn;
 #ifndef __SINGLE_THREAD__
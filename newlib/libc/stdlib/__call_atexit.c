@@ -11,6 +11,12 @@
 /* Make this a weak reference to avoid pulling in free.  */
 void free(void *) _ATTRIBUTE((__weak__));
 
+#ifdef _ATEXIT_DYNAMIC_ALLOC
+/* Likewise, don't pull in __register_exitproc just for its index.  */
+int __atexit_dso_top (void *, struct _atexit **, int *) _ATTRIBUTE((__weak__));
+void __atexit_dso_pop (void *, struct _atexit *, int) _ATTRIBUTE((__weak__));
+#endif
+
 #ifndef __SINGLE_THREAD__
 __LOCK_INIT_RECURSIVE(, __atexit_recursive_mutex);
 #endif
@@ -67,10 +73,10 @@ register_fini(void)
 void 
 __call_exitprocs (int code, void *d)
 {
-  register struct _atexit *p;
+  struct _atexit *p;
   struct _atexit **lastp;
   register struct _on_exit_args * args;
-  register int n;
+  int n;
   int i;
   void (*fn) (void);
 
@@ -79,6 +85,66 @@ __call_exitprocs (int code, void *d)
   __lock_acquire_recursive(__atexit_recursive_mutex);
 #endif
 
+#ifdef _ATEXIT_DYNAMIC_ALLOC
+  /* For a single DSO, take its handlers from the index kept by
+     __register_exitproc instead of scanning all handlers.  Handlers
+     registered by the handlers called land on top of the index and are
+     called next.  */
+  if (d && __atexit_dso_top)
+    {
+      int found;
+
+      while ((found = __atexit_dso_top (d, &p, &n)) > 0)
+	{
+#ifdef _REENT_SMALL
+	  args = p->_on_exit_args_ptr;
+#else
+	  args = &p->_on_exit_args;
+#endif
+	  i = 1 << n;
+
+	  __atexit_dso_pop (d, p, n);
+	  fn = p->_fns[n];
+	  p->_fns[n] = NULL;
+	  /* Drop this and any slots below it already called, so that
+	     the block ends up empty once all of its handlers ran.  */
+	  while (p->_ind > 0 && p->_fns[p->_ind - 1] == NULL)
+	    p->_ind--;
+
+	  if (!fn)
+	    continue;
+
+	  if ((args->_is_cxa & i) == 0)
+	    (*((void (*)(int, void *)) fn))(code, args->_fnargs[n]);
+	  else
+	    (*((void (*)(void *)) fn))(args->_fnargs[n]);
+	}
+
+      /* Otherwise the index has been dropped; scan.  */
+      if (found == 0)
+	{
+	  /* Free the blocks emptied above, except the last one, as the
+	     scan below does.  */
+	  lastp = &_GLOBAL_ATEXIT;
+	  while ((p = *lastp) != NULL && free)
+	    {
+	      if (p->_ind == 0 && p->_next)
+		{
+		  *lastp = p->_next;
+#ifdef _REENT_SMALL
+		  if (p->_on_exit_args_ptr)
+		    free (p->_on_exit_args_ptr);
+#endif
+		  free (p);
+		}
+	      else
+		lastp = &p->_next;
+	    }
+	  goto out;
+	}
+    }
+#endif
+
  restart:
 
   p = _GLOBAL_ATEXIT;
@@ -112,6 +178,12 @@ __call_exitprocs (int code, void *d)
 	  if (!fn)
 	    continue;
 
+#ifdef _ATEXIT_DYNAMIC_ALLOC
+	  if (args && (args->_fntypes & i) && args->_dso_handle[n]
+	      && __atexit_dso_pop)
+	    __atexit_dso_pop (args->_dso_handle[n], p, n);
+#endif
+
 	  ind = p->_ind;
 
 	  /* Call the function.  */
@@ -157,6 +229,10 @@ __call_exitprocs (int code, void *d)
 	}
 #endif
     }
+
+#ifdef _ATEXIT_DYNAMIC_ALLOC
+ out:
+#endif
 #ifndef __SINGLE_THREAD__
   __lock_release_recursive(__atexit_recursive_mutex);
 #endif
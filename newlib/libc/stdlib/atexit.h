@@ -12,3 +12,9 @@ enum __atexit_types
 void __call_exitprocs (int, void *);
 int __register_exitproc (int, void (*fn) (void), void *, void *);
 
+#ifdef _ATEXIT_DYNAMIC_ALLOC
+/* Per-DSO index of the slots holding __cxa_atexit handlers, see
+   __atexit.c.  */
+int __atexit_dso_top (void *, struct _atexit **, int *);
+void __atexit_dso_pop (void *, struct _atexit *, int);
+#endif
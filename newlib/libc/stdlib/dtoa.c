@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <reent.h>
 #include <string.h>
+#include <sys/_tracepoint.h>
 #include "mprec.h"
 
 static int
@@ -231,6 +232,8 @@ _dtoa_r (struct _reent *ptr,
 
   d.d = _d;
 
+  __TRACEPOINT2 (dtoa, mode, ndigits);
+
   _REENT_CHECK_MP(ptr);
   if (_REENT_MP_RESULT(ptr))
     {
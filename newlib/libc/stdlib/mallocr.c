@@ -274,6 +274,7 @@ extern "C" {
 #include <stdio.h>    /* needed for malloc_stats */
 #include <limits.h>   /* needed for overflow checks */
 #include <errno.h>    /* needed to set errno to ENOMEM */
+#include <sys/_tracepoint.h> /* marks malloc and free for tracing tools */
 
 #ifdef WIN32
 #define WIN32_LEAN_AND_MEAN
@@ -302,6 +303,7 @@ extern "C" {
  */
 
 #include <reent.h>
+#include <sys/_tracepoint.h>
 
 #define POINTER_UINT unsigned _POINTER_INT
 #define SEPARATE_OBJECTS
@@ -2320,6 +2322,12 @@ static void malloc_extend_top(RARG nb) RDECL INTERNAL_SIZE_T nb;
 
 */
 
+/* Return P from mALLOc, firing the malloc_return tracepoint. */
+
+#define MALLOC_RETURN(p) \
+  do { Void_t* ret_ = (p); \
+       __TRACEPOINT2(malloc_return, bytes, ret_); return ret_; } while (0)
+
 #if __STD_C
 Void_t* mALLOc(RARG size_t bytes)
 #else
@@ -2347,11 +2355,13 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
 
   INTERNAL_SIZE_T nb  = request2size(bytes);  /* padded request size; */
 
+  __TRACEPOINT1(malloc_entry, bytes);
+
   /* Check for overflow and just fail, if so. */
   if (nb > INT_MAX || nb < bytes)
   {
     RERRNO = ENOMEM;
-    return 0;
+    MALLOC_RETURN(0);
   }
 
   MALLOC_LOCK;
@@ -2382,7 +2392,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
       set_inuse_bit_at_offset(victim, victim_size);
       check_malloced_chunk(victim, nb);
       MALLOC_UNLOCK;
-      return chunk2mem(victim);
+      MALLOC_RETURN(chunk2mem(victim));
     }
 
     idx += 2; /* Set for bin scan below. We've already scanned 2 bins. */
@@ -2410,7 +2420,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
         set_inuse_bit_at_offset(victim, victim_size);
         check_malloced_chunk(victim, nb);
 	MALLOC_UNLOCK;
-        return chunk2mem(victim);
+        MALLOC_RETURN(chunk2mem(victim));
       }
     }
 
@@ -2434,7 +2444,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
       set_foot(remainder, remainder_size);
       check_malloced_chunk(victim, nb);
       MALLOC_UNLOCK;
-      return chunk2mem(victim);
+      MALLOC_RETURN(chunk2mem(victim));
     }
 
     clear_last_remainder;
@@ -2444,7 +2454,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
       set_inuse_bit_at_offset(victim, victim_size);
       check_malloced_chunk(victim, nb);
       MALLOC_UNLOCK;
-      return chunk2mem(victim);
+      MALLOC_RETURN(chunk2mem(victim));
     }
 
     /* Else place in bin */
@@ -2500,7 +2510,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
             set_foot(remainder, remainder_size);
             check_malloced_chunk(victim, nb);
 	    MALLOC_UNLOCK;
-            return chunk2mem(victim);
+            MALLOC_RETURN(chunk2mem(victim));
           }
 
           else if (remainder_size >= 0)  /* take */
@@ -2509,7 +2519,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
             unlink(victim, bck, fwd);
             check_malloced_chunk(victim, nb);
 	    MALLOC_UNLOCK;
-            return chunk2mem(victim);
+            MALLOC_RETURN(chunk2mem(victim));
           }
 
         }
@@ -2567,7 +2577,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
         (victim = mmap_chunk(nb)) != 0)
     {
       MALLOC_UNLOCK;
-      return chunk2mem(victim);
+      MALLOC_RETURN(chunk2mem(victim));
     }
 #endif
 
@@ -2577,7 +2587,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
     if (chunksize(top) < nb || remainder_size < (long)MINSIZE)
     {
       MALLOC_UNLOCK;
-      return 0; /* propagate failure */
+      MALLOC_RETURN(0); /* propagate failure */
     }
   }
 
@@ -2587,7 +2597,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
   set_head(top, remainder_size | PREV_INUSE);
   check_malloced_chunk(victim, nb);
   MALLOC_UNLOCK;
-  return chunk2mem(victim);
+  MALLOC_RETURN(chunk2mem(victim));
 
 #endif /* MALLOC_PROVIDED */
 }
@@ -2644,6 +2654,8 @@ void fREe(RARG mem) RDECL Void_t* mem;
   if (mem == 0)                              /* free(0) has no effect */
     return;
 
+  __TRACEPOINT1(free_entry, mem);
+
   MALLOC_LOCK;
 
   p = mem2chunk(mem);
@@ -2654,6 +2666,7 @@ void fREe(RARG mem) RDECL Void_t* mem;
   {
     munmap_chunk(p);
     MALLOC_UNLOCK;
+    __TRACEPOINT1(free_return, mem);
     return;
   }
 #endif
@@ -2681,6 +2694,7 @@ void fREe(RARG mem) RDECL Void_t* mem;
     if ((unsigned long)(sz) >= (unsigned long)trim_threshold) 
       malloc_trim(RCALL top_pad); 
     MALLOC_UNLOCK;
+    __TRACEPOINT1(free_return, mem);
     return;
   }
 
@@ -2720,6 +2734,7 @@ void fREe(RARG mem) RDECL Void_t* mem;
     frontlink(p, sz, idx, bck, fwd);  
 
   MALLOC_UNLOCK;
+  __TRACEPOINT1(free_return, mem);
 
 #endif /* MALLOC_PROVIDED */
 }
@@ -39,6 +39,7 @@ clock_getres (clockid_t clock_id, struct timespec *res)
   switch (clock_id)
     {
     case CLOCK_REALTIME:
+    case CLOCK_MONOTONIC:
       {
 	long int clk_tck = sysconf (_SC_CLK_TCK);
 
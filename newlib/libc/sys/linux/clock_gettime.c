@@ -22,6 +22,14 @@
 #include <sys/time.h>
 #include <libc-internal.h>
 #include <hp-timing.h>
+#include <machine/syscall.h>
+
+/* The kernel numbers its clocks differently from <time.h>.  */
+#define LINUX_CLOCK_MONOTONIC	1
+
+#define __NR___sys_clock_gettime __NR_clock_gettime
+
+static _syscall2(int,__sys_clock_gettime,int,clock_id,struct timespec *,tp);
 
 
 #if HP_TIMING_AVAIL
@@ -43,7 +51,7 @@ extern int __pthread_clock_gettime (hp_timing_t freq, struct timespec *tp)
 
 /* Get current value of CLOCK and store it in TP.  */
 int
-clock_gettime (clockid_t clock_id, struct timespec *tp)
+__clock_gettime (clockid_t clock_id, struct timespec *tp)
 {
   struct timeval tv;
   int retval = -1;
@@ -57,6 +65,10 @@ clock_gettime (clockid_t clock_id, struct timespec *tp)
 	TIMEVAL_TO_TIMESPEC (&tv, tp);
       break;
 
+    case CLOCK_MONOTONIC:
+      retval = __sys_clock_gettime (LINUX_CLOCK_MONOTONIC, tp);
+      break;
+
 #if HP_TIMING_AVAIL
     case CLOCK_PROCESS_CPUTIME_ID:
     case CLOCK_THREAD_CPUTIME_ID:
@@ -107,3 +119,4 @@ clock_gettime (clockid_t clock_id, struct timespec *tp)
 
   return retval;
 }
+weak_alias(__clock_gettime,clock_gettime)
@@ -0,0 +1,23 @@
+/* libc/sys/linux/epoll.c - I/O event notification */
+
+#include <sys/epoll.h>
+#include <machine/syscall.h>
+
+_syscall1(int,epoll_create,int,size);
+_syscall4(int,epoll_ctl,int,epfd,int,op,int,fd,struct epoll_event *,event);
+_syscall4(int,epoll_wait,int,epfd,struct epoll_event *,events,int,maxevents,int,timeout);
+
+#ifdef __NR_epoll_create1
+_syscall1(int,epoll_create1,int,flags);
+#else
+int
+epoll_create1 (int flags)
+{
+  if (flags != 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  return epoll_create (1);
+}
+#endif
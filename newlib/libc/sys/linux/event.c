@@ -0,0 +1,523 @@
+/* libc/sys/linux/event.c - kqueue and kevent on top of epoll */
+
+/* See <sys/event.h>.  A kqueue is an epoll descriptor plus a table,
+   indexed by descriptor, of the filters registered on each one.  epoll
+   keeps a single registration per descriptor, so the read and write
+   filters of a descriptor are merged into one event mask, and one epoll
+   event may turn into two kevents.  A timer is a timerfd with an entry
+   of its own, kept on a list to be found by its identifier.
+
+   The table of a kqueue is found through its epoll descriptor.  close
+   calls __kqueue_close first, which releases the table with the
+   timerfds of its timers.  A descriptor can also go away through dup2
+   or exec, so each call to kqueue also looks for kqueues whose
+   descriptor is closed or no longer their epoll instance.  To tell the
+   instance apart from a later one with the same number, a kqueue with
+   timers keeps an extra timerfd, its anchor, registered with no events.
+   One kqueue must not be used by two threads at the same time.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/event.h>
+#include <sys/lock.h>
+#include <sys/queue.h>
+#include <sys/timerfd.h>
+
+/* Timers are always armed relative to the current time, so that setting
+   the time of day does not move them.  */
+#define KQ_CLOCK	CLOCK_MONOTONIC
+
+#define EPOLL_BATCH	64
+
+struct kq_filter {
+  int on;				/* registered */
+  u_short flags;			/* EV_ONESHOT, EV_CLEAR, EV_DISABLE */
+  u_int fflags;
+  void *udata;
+};
+
+struct kq_fd {
+  int fd;				/* descriptor, or a timer's timerfd */
+  int mask;				/* events registered with epoll */
+  int timer;
+  uintptr_t ident;			/* timer identifier */
+  struct kq_filter rd, wr;		/* a timer only uses rd */
+  LIST_ENTRY(kq_fd) link;		/* on the timer list */
+};
+
+struct kq {
+  int epfd;
+  struct kq_fd **fds;
+  int nfds;
+  LIST_HEAD(, kq_fd) timers;
+  int anchor;				/* timerfd registered with no events */
+  struct kevent pending;		/* an event that did not fit */
+  int npending;
+};
+
+__LOCK_INIT_RECURSIVE(static, kq_lock);
+static struct kq **kqs;
+static int nkqs;
+
+#define FILTER_ACTIVE(f)	((f)->on && !((f)->flags & EV_DISABLE))
+
+/* Make room for index I in the pointer array *A of *N entries.  */
+static int
+grow (void ***a, int *n, int i)
+{
+  void **p;
+  int len;
+
+  if (i < *n)
+    return 0;
+  len = *n ? *n : 16;
+  while (len <= i)
+    len *= 2;
+  if ((p = realloc (*a, len * sizeof *p)) == NULL)
+    return -1;
+  memset (p + *n, 0, (len - *n) * sizeof *p);
+  *a = p;
+  *n = len;
+  return 0;
+}
+
+static void
+kq_free (struct kq *kq)
+{
+  struct kq_fd *kf;
+  int i;
+
+  while ((kf = LIST_FIRST (&kq->timers)) != NULL)
+    {
+      LIST_REMOVE (kf, link);
+      close (kf->fd);
+      free (kf);
+    }
+  if (kq->anchor >= 0)
+    close (kq->anchor);
+  for (i = 0; i < kq->nfds; i++)
+    free (kq->fds[i]);
+  free (kq->fds);
+  free (kq);
+}
+
+/* Whether the descriptor of KQ has been closed, or reused for anything
+   but KQ's epoll instance.  Without an anchor a reused descriptor looks
+   alive, but such a kqueue holds no descriptors of its own.  */
+static int
+kq_stale (struct kq *kq)
+{
+  struct epoll_event ev;
+
+  if (kq->anchor < 0)
+    return fcntl (kq->epfd, F_GETFD) < 0 && errno == EBADF;
+  ev.events = 0;
+  ev.data.ptr = NULL;
+  return epoll_ctl (kq->epfd, EPOLL_CTL_MOD, kq->anchor, &ev) < 0;
+}
+
+/* Release stale kqueues.  Called with kq_lock held, which is recursive
+   because kq_free closes descriptors and so calls __kqueue_close.  */
+static void
+kq_sweep (void)
+{
+  struct kq *kq;
+  int i, save = errno;
+
+  for (i = 0; i < nkqs; i++)
+    if ((kq = kqs[i]) != NULL && kq_stale (kq))
+      {
+	kqs[i] = NULL;
+	kq_free (kq);
+      }
+  errno = save;
+}
+
+static struct kq *
+kq_lookup (int fd)
+{
+  struct kq *kq = NULL;
+
+  __lock_acquire_recursive (kq_lock);
+  if (fd >= 0 && fd < nkqs)
+    kq = kqs[fd];
+  __lock_release_recursive (kq_lock);
+  return kq;
+}
+
+/* Called by close before FD is closed.  */
+void
+__kqueue_close (int fd)
+{
+  struct kq *kq;
+  int save = errno;
+
+  __lock_acquire_recursive (kq_lock);
+  if (fd >= 0 && fd < nkqs && (kq = kqs[fd]) != NULL)
+    {
+      kqs[fd] = NULL;
+      kq_free (kq);
+    }
+  __lock_release_recursive (kq_lock);
+  errno = save;
+}
+
+int
+kqueue (void)
+{
+  struct kq *kq;
+  int epfd;
+
+  if ((epfd = epoll_create1 (EPOLL_CLOEXEC)) < 0)
+    return -1;
+  if ((kq = calloc (1, sizeof *kq)) == NULL)
+    goto nomem;
+  kq->epfd = epfd;
+  kq->anchor = -1;
+  LIST_INIT (&kq->timers);
+
+  __lock_acquire_recursive (kq_lock);
+  kq_sweep ();
+  if (grow ((void ***) &kqs, &nkqs, epfd) < 0)
+    {
+      __lock_release_recursive (kq_lock);
+      free (kq);
+      goto nomem;
+    }
+  if (kqs[epfd])
+    kq_free (kqs[epfd]);
+  kqs[epfd] = kq;
+  __lock_release_recursive (kq_lock);
+  return epfd;
+
+nomem:
+  close (epfd);
+  errno = ENOMEM;
+  return -1;
+}
+
+/* Bring the epoll registration of KF in line with its filters.  */
+static int
+kq_update (struct kq *kq, struct kq_fd *kf)
+{
+  struct epoll_event ev;
+  int mask = 0, edge = 1, op, r;
+
+  if (FILTER_ACTIVE (&kf->rd))
+    {
+      mask |= EPOLLIN | EPOLLRDHUP;
+      edge &= (kf->rd.flags & EV_CLEAR) != 0;
+    }
+  if (FILTER_ACTIVE (&kf->wr))
+    {
+      mask |= EPOLLOUT;
+      edge &= (kf->wr.flags & EV_CLEAR) != 0;
+    }
+  if (mask && edge)
+    mask |= EPOLLET;
+  if (mask == kf->mask)
+    return 0;
+
+  op = !mask ? EPOLL_CTL_DEL : !kf->mask ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+  ev.events = mask;
+  ev.data.ptr = kf;
+  r = epoll_ctl (kq->epfd, op, kf->fd, &ev);
+
+  /* Closing a descriptor drops its epoll registration behind our back,
+     and the number may since have been reused.  */
+  if (r < 0 && op == EPOLL_CTL_ADD && errno == EEXIST)
+    r = epoll_ctl (kq->epfd, EPOLL_CTL_MOD, kf->fd, &ev);
+  else if (r < 0 && op == EPOLL_CTL_MOD && errno == ENOENT)
+    r = epoll_ctl (kq->epfd, EPOLL_CTL_ADD, kf->fd, &ev);
+  else if (r < 0 && op == EPOLL_CTL_DEL && (errno == ENOENT || errno == EBADF))
+    r = 0;
+  if (r == 0)
+    kf->mask = mask;
+  return r;
+}
+
+/* Give KQ its anchor before its first timer, returning 0 or an error
+   number.  The anchor never reports an event.  */
+static int
+kq_anchor (struct kq *kq)
+{
+  struct epoll_event ev;
+  int fd, err;
+
+  if (kq->anchor >= 0)
+    return 0;
+  if ((fd = timerfd_create (KQ_CLOCK, TFD_CLOEXEC)) < 0)
+    return errno;
+  ev.events = 0;
+  ev.data.ptr = NULL;
+  if (epoll_ctl (kq->epfd, EPOLL_CTL_ADD, fd, &ev) < 0)
+    {
+      err = errno;
+      close (fd);
+      return err;
+    }
+  __lock_acquire_recursive (kq_lock);
+  kq->anchor = fd;
+  __lock_release_recursive (kq_lock);
+  return 0;
+}
+
+static void
+kq_timer_free (struct kq_fd *kf)
+{
+  LIST_REMOVE (kf, link);
+  close (kf->fd);
+  free (kf);
+}
+
+static int
+kq_timer_arm (struct kq_fd *kf, intptr_t msecs)
+{
+  struct itimerspec its;
+
+  if (msecs < 0)
+    return EINVAL;
+  its.it_value.tv_sec = msecs / 1000;
+  its.it_value.tv_nsec = (msecs % 1000) * 1000000;
+  if (msecs == 0)
+    its.it_value.tv_nsec = 1;		/* 0 would disarm it */
+  if (kf->rd.flags & EV_ONESHOT)
+    its.it_interval.tv_sec = its.it_interval.tv_nsec = 0;
+  else
+    its.it_interval = its.it_value;
+  return timerfd_settime (kf->fd, 0, &its, NULL) < 0 ? errno : 0;
+}
+
+/* Apply one change, returning 0 or an error number.  */
+static int
+kq_change (struct kq *kq, const struct kevent *kev)
+{
+  struct kq_fd *kf = NULL;
+  struct kq_filter *f;
+  int fd, err, was_on;
+
+  switch (kev->filter)
+    {
+    case EVFILT_READ:
+    case EVFILT_WRITE:
+      fd = (int) kev->ident;
+      if (fd < 0)
+	return EBADF;
+      if (fd < kq->nfds)
+	kf = kq->fds[fd];
+      if (kf == NULL)
+	{
+	  if (!(kev->flags & EV_ADD))
+	    return ENOENT;
+	  if (grow ((void ***) &kq->fds, &kq->nfds, fd) < 0
+	      || (kf = calloc (1, sizeof *kf)) == NULL)
+	    return ENOMEM;
+	  kf->fd = fd;
+	  kq->fds[fd] = kf;
+	}
+      f = kev->filter == EVFILT_READ ? &kf->rd : &kf->wr;
+      break;
+
+    case EVFILT_TIMER:
+      LIST_FOREACH (kf, &kq->timers, link)
+	if (kf->ident == kev->ident)
+	  break;
+      if (kf == NULL)
+	{
+	  if (!(kev->flags & EV_ADD))
+	    return ENOENT;
+	  if ((err = kq_anchor (kq)) != 0)
+	    return err;
+	  if ((kf = calloc (1, sizeof *kf)) == NULL)
+	    return ENOMEM;
+	  kf->fd = timerfd_create (KQ_CLOCK, TFD_NONBLOCK | TFD_CLOEXEC);
+	  if (kf->fd < 0)
+	    {
+	      err = errno;
+	      free (kf);
+	      return err;
+	    }
+	  kf->timer = 1;
+	  kf->ident = kev->ident;
+	  LIST_INSERT_HEAD (&kq->timers, kf, link);
+	}
+      f = &kf->rd;
+      break;
+
+    default:
+      return EINVAL;
+    }
+
+  was_on = f->on;
+  if (kev->flags & EV_DELETE)
+    {
+      if (!f->on)
+	return ENOENT;
+      if (kf->timer)
+	{
+	  kq_timer_free (kf);
+	  return 0;
+	}
+      f->on = 0;
+    }
+  else if (kev->flags & EV_ADD)
+    {
+      f->on = 1;
+      f->flags = kev->flags & (EV_ONESHOT | EV_CLEAR | EV_DISABLE);
+      f->fflags = kev->fflags;
+      f->udata = kev->udata;
+      if (kf->timer && (err = kq_timer_arm (kf, kev->data)) != 0)
+	goto fail;
+    }
+  else if (!f->on)
+    return ENOENT;
+  else if (kev->flags & EV_ENABLE)
+    f->flags &= ~EV_DISABLE;
+  else if (kev->flags & EV_DISABLE)
+    f->flags |= EV_DISABLE;
+
+  if (kq_update (kq, kf) == 0)
+    return 0;
+  err = errno;
+
+fail:
+  if (kf->timer && !was_on)
+    kq_timer_free (kf);
+  else
+    f->on = was_on;
+  return err;
+}
+
+/* Turn epoll EVENTS on KF into at most ROOM kevents at OUT, keeping one
+   that does not fit for the next call.  Return the number stored.  */
+static int
+kq_deliver (struct kq *kq, struct kq_fd *kf, int events,
+	    struct kevent *out, int room)
+{
+  struct kevent kev[2];
+  __uint64_t expirations;
+  int n = 0, i, oneshot = 0;
+
+  if (kf->timer)
+    {
+      if (!FILTER_ACTIVE (&kf->rd)
+	  || read (kf->fd, &expirations, sizeof expirations)
+	     != sizeof expirations)
+	return 0;
+      EV_SET (&kev[0], kf->ident, EVFILT_TIMER, kf->rd.flags, 0,
+	      (intptr_t) expirations, kf->rd.udata);
+      if (kf->rd.flags & EV_ONESHOT)
+	kq_timer_free (kf);
+      n = 1;
+    }
+  else
+    {
+      if (FILTER_ACTIVE (&kf->rd)
+	  && (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)))
+	{
+	  EV_SET (&kev[n], kf->fd, EVFILT_READ, kf->rd.flags, kf->rd.fflags,
+		  0, kf->rd.udata);
+	  if (events & (EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+	    kev[n].flags |= EV_EOF;
+	  if (kf->rd.flags & EV_ONESHOT)
+	    kf->rd.on = 0, oneshot = 1;
+	  n++;
+	}
+      if (FILTER_ACTIVE (&kf->wr)
+	  && (events & (EPOLLOUT | EPOLLHUP | EPOLLERR)))
+	{
+	  EV_SET (&kev[n], kf->fd, EVFILT_WRITE, kf->wr.flags, kf->wr.fflags,
+		  0, kf->wr.udata);
+	  if (events & (EPOLLHUP | EPOLLERR))
+	    kev[n].flags |= EV_EOF;
+	  if (kf->wr.flags & EV_ONESHOT)
+	    kf->wr.on = 0, oneshot = 1;
+	  n++;
+	}
+      if (oneshot)
+	kq_update (kq, kf);
+    }
+
+  for (i = 0; i < n && i < room; i++)
+    out[i] = kev[i];
+  if (i < n)
+    {
+      kq->pending = kev[i];
+      kq->npending = 1;
+    }
+  return i;
+}
+
+int
+kevent (int kqfd, const struct kevent *changelist, int nchanges,
+	struct kevent *eventlist, int nevents, const struct timespec *timeout)
+{
+  struct epoll_event ev[EPOLL_BATCH];
+  struct kq *kq;
+  int i, n = 0, r, want, msecs;
+
+  if ((kq = kq_lookup (kqfd)) == NULL)
+    {
+      errno = EBADF;
+      return -1;
+    }
+
+  /* Errors in the changes are reported as EV_ERROR events while there
+     is room, and then the call returns without waiting.  */
+  for (i = 0; i < nchanges; i++)
+    if ((r = kq_change (kq, &changelist[i])) != 0)
+      {
+	if (n >= nevents)
+	  {
+	    errno = r;
+	    return -1;
+	  }
+	eventlist[n] = changelist[i];
+	eventlist[n].flags = EV_ERROR;
+	eventlist[n].data = r;
+	n++;
+      }
+  if (n > 0 || nevents <= 0)
+    return n;
+
+  if (timeout == NULL)
+    msecs = -1;
+  else if (timeout->tv_sec >= INT_MAX / 1000)
+    msecs = INT_MAX;
+  else
+    msecs = timeout->tv_sec * 1000 + (timeout->tv_nsec + 999999) / 1000000;
+
+  if (kq->npending)
+    {
+      eventlist[n++] = kq->pending;
+      kq->npending = 0;
+      msecs = 0;
+    }
+
+  do
+    {
+      /* Each epoll event gives at most two kevents, so asking for half
+	 the free slots, rounded up, overflows by one at most.  */
+      want = (nevents - n + 1) / 2;
+      if (want == 0)
+	break;
+      if (want > EPOLL_BATCH)
+	want = EPOLL_BATCH;
+      r = epoll_wait (kq->epfd, ev, want, msecs);
+      if (r < 0)
+	return n > 0 ? n : -1;
+      for (i = 0; i < r; i++)
+	n += kq_deliver (kq, ev[i].data.ptr, ev[i].events,
+			 eventlist + n, nevents - n);
+    }
+  /* Only events that turned out stale were seen; wait again.  */
+  while (n == 0 && r > 0);
+
+  return n;
+}
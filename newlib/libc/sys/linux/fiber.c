@@ -0,0 +1,279 @@
+/* libc/sys/linux/fiber.c - Cooperative user-space fibers */
+
+/* See <sys/fiber.h>.  Each fiber's descriptor, including its struct
+   _reent, lives at the top of its stack mapping, so creating a fiber
+   costs one mmap and one mprotect for the guard page.  The register
+   switch is __fiber_swap in the machine directory; a new stack is laid
+   out to look like one saved by it, returning into fiber_start.  */
+
+#include <errno.h>
+#include <reent.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/queue.h>
+#include <sys/fiber.h>
+
+#define EPOLL_BATCH	64
+
+enum fiber_state {
+  FIBER_RUNNING,
+  FIBER_READY,				/* on the run queue */
+  FIBER_BLOCKED,			/* in fiber_join or fiber_wait_fd */
+  FIBER_DONE
+};
+
+struct __fiber {
+  void *sp;				/* saved by __fiber_swap */
+  enum fiber_state state;
+  void *(*fn) (void *);
+  void *arg;
+  void *retval;
+  int revents;				/* result of fiber_wait_fd */
+  struct __fiber *joiner;
+  void *map;				/* stack mapping, guard page first */
+  size_t maplen;
+  struct _reent *reentp;
+  TAILQ_ENTRY(__fiber) link;
+  struct _reent reent;
+};
+
+extern void __fiber_swap (void **, void *);
+extern void __setreent (struct _reent *);
+
+static struct __fiber main_fiber;
+static struct __fiber *current;
+static TAILQ_HEAD(, __fiber) runq = TAILQ_HEAD_INITIALIZER(runq);
+static int epfd = -1;
+static int nwaiting;			/* fibers in fiber_wait_fd */
+
+static void
+fiber_init (void)
+{
+  if (current)
+    return;
+  main_fiber.state = FIBER_RUNNING;
+  main_fiber.reentp = _REENT;
+  current = &main_fiber;
+}
+
+static void
+switch_to (struct __fiber *next)
+{
+  struct __fiber *prev = current;
+
+  current = next;
+  next->state = FIBER_RUNNING;
+  __setreent (next->reentp);
+  __fiber_swap (&prev->sp, next->sp);
+}
+
+/* Wait up to TIMEOUT milliseconds for I/O and make the fibers waiting
+   for it runnable.  */
+static int
+poll_io (int timeout)
+{
+  struct epoll_event ev[EPOLL_BATCH];
+  struct __fiber *f;
+  int i, n;
+
+  n = epoll_wait (epfd, ev, EPOLL_BATCH, timeout);
+  for (i = 0; i < n; i++)
+    {
+      f = ev[i].data.ptr;
+      f->revents = ev[i].events;
+      f->state = FIBER_READY;
+      TAILQ_INSERT_TAIL (&runq, f, link);
+      nwaiting--;
+    }
+  return n;
+}
+
+/* Run the next runnable fiber.  The caller has already queued itself or
+   recorded why it is blocked.  Return when the caller is resumed, or
+   with an error number if nothing can ever run again.  */
+static int
+schedule (void)
+{
+  struct __fiber *next;
+
+  for (;;)
+    {
+      next = TAILQ_FIRST (&runq);
+      if (next)
+	{
+	  TAILQ_REMOVE (&runq, next, link);
+	  if (next == current)
+	    next->state = FIBER_RUNNING;
+	  else
+	    switch_to (next);
+	  return 0;
+	}
+      if (nwaiting == 0)
+	return EDEADLK;
+      if (poll_io (-1) < 0 && errno != EINTR)
+	return errno;
+    }
+}
+
+static void
+fiber_start (void)
+{
+  struct __fiber *self = current;
+
+  self->retval = self->fn (self->arg);
+  self->state = FIBER_DONE;
+  if (self->joiner)
+    {
+      self->joiner->state = FIBER_READY;
+      TAILQ_INSERT_TAIL (&runq, self->joiner, link);
+    }
+  schedule ();
+  /* Every other fiber is blocked for good.  */
+  abort ();
+}
+
+int
+fiber_create (fiber_t *fiber, size_t stacksize,
+	      void *(*fn) (void *), void *arg)
+{
+  size_t pagesize = getpagesize ();
+  struct __fiber *f;
+  void **sp;
+  char *map;
+  size_t len;
+
+  fiber_init ();
+  if (stacksize == 0)
+    stacksize = FIBER_STACK_DEFAULT;
+  len = (stacksize + sizeof (struct __fiber) + 2 * pagesize - 1)
+    & ~(pagesize - 1);
+  map = mmap (NULL, len, PROT_READ | PROT_WRITE,
+	      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (map == MAP_FAILED)
+    return EAGAIN;
+  if (mprotect (map, pagesize, PROT_NONE) < 0)
+    {
+      munmap (map, len);
+      return EAGAIN;
+    }
+
+  f = (struct __fiber *) ((unsigned long) (map + len - sizeof *f)
+			  & ~(unsigned long) 15);
+  f->fn = fn;
+  f->arg = arg;
+  f->map = map;
+  f->maplen = len;
+  f->reentp = &f->reent;
+  _REENT_INIT_PTR (f->reentp);
+
+  /* Below the descriptor, a null return address for fiber_start and the
+     context __fiber_swap restores: fiber_start and four zero registers.
+     Keep the stack 16-byte aligned at the call, as the ABI expects.  */
+  sp = (void **) f;
+  *--sp = NULL;
+  *--sp = (void *) fiber_start;
+  sp -= 4;
+  memset (sp, 0, 4 * sizeof *sp);
+  f->sp = sp;
+
+  f->state = FIBER_READY;
+  TAILQ_INSERT_TAIL (&runq, f, link);
+  *fiber = f;
+  return 0;
+}
+
+int
+fiber_join (fiber_t fiber, void **retval)
+{
+  int err;
+
+  fiber_init ();
+  if (fiber == current)
+    return EDEADLK;
+  if (fiber->map == NULL || fiber->joiner)
+    return EINVAL;
+  if (fiber->state != FIBER_DONE)
+    {
+      fiber->joiner = current;
+      current->state = FIBER_BLOCKED;
+      if ((err = schedule ()) != 0)
+	{
+	  fiber->joiner = NULL;
+	  current->state = FIBER_RUNNING;
+	  return err;
+	}
+    }
+  if (retval)
+    *retval = fiber->retval;
+  _reclaim_reent (fiber->reentp);
+  munmap (fiber->map, fiber->maplen);
+  return 0;
+}
+
+int
+fiber_switch (fiber_t fiber)
+{
+  fiber_init ();
+  if (fiber == current)
+    return 0;
+  if (fiber->state != FIBER_READY)
+    return EINVAL;
+  TAILQ_REMOVE (&runq, fiber, link);
+  current->state = FIBER_READY;
+  TAILQ_INSERT_TAIL (&runq, current, link);
+  switch_to (fiber);
+  return 0;
+}
+
+void
+fiber_yield (void)
+{
+  fiber_init ();
+  if (nwaiting)
+    poll_io (0);
+  if (TAILQ_EMPTY (&runq))
+    return;
+  current->state = FIBER_READY;
+  TAILQ_INSERT_TAIL (&runq, current, link);
+  schedule ();
+}
+
+fiber_t
+fiber_self (void)
+{
+  fiber_init ();
+  return current;
+}
+
+int
+fiber_wait_fd (int fd, int events)
+{
+  struct epoll_event ev;
+  int err;
+
+  fiber_init ();
+  if (epfd < 0 && (epfd = epoll_create1 (EPOLL_CLOEXEC)) < 0)
+    return -1;
+
+  /* A one-shot registration stays in the set, disabled, once it has
+     fired, so a later wait on the same descriptor modifies it.  */
+  ev.events = events | EPOLLONESHOT;
+  ev.data.ptr = current;
+  if (epoll_ctl (epfd, EPOLL_CTL_ADD, fd, &ev) < 0
+      && (errno != EEXIST || epoll_ctl (epfd, EPOLL_CTL_MOD, fd, &ev) < 0))
+    return -1;
+
+  current->state = FIBER_BLOCKED;
+  nwaiting++;
+  if ((err = schedule ()) != 0)
+    {
+      nwaiting--;
+      epoll_ctl (epfd, EPOLL_CTL_DEL, fd, &ev);
+      current->state = FIBER_RUNNING;
+      errno = err;
+      return -1;
+    }
+  return current->revents;
+}
@@ -10,3 +10,11 @@ __libc_getreent (void)
 }
 weak_alias(__libc_getreent,__getreent)
 
+
+/* make R the reentrant pointer returned by __getreent */
+void
+__libc_setreent (struct _reent *r)
+{
+  _impure_ptr = r;
+}
+weak_alias(__libc_setreent,__setreent)
@@ -0,0 +1,243 @@
+/* libc/sys/linux/gmon.c - profiling setup and gmon.out writer */
+
+/* monstartup allocates the PC histogram and the call graph arc table
+   (see mcount.c) and starts sampling with profil.  At exit, _mcleanup
+   writes both to gmon.out in the tagged GNU format, which stock gprof
+   reads.  */
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/gmon.h>
+#include <sys/gmon_out.h>
+#include <libc-internal.h>
+
+struct gmonparam _gmonparam = { GMON_PROF_OFF };
+
+static u_int s_scale;
+/* see profil(2) where this is described (incorrectly) */
+#define		SCALE_1_TO_1	0x10000L
+
+#define ERR(s) write (2, s, sizeof (s) - 1)
+
+void
+__monstartup (u_long lowpc, u_long highpc)
+{
+  struct gmonparam *p = &_gmonparam;
+  u_long narcs, nslots, arcsize;
+  char *cp;
+
+  /* Round lowpc and highpc to multiples of the density we're using
+     so the rest of the scaling (here and in gprof) stays in ints.  */
+  p->lowpc = ROUNDDOWN (lowpc, HISTFRACTION * sizeof (HISTCOUNTER));
+  p->highpc = ROUNDUP (highpc, HISTFRACTION * sizeof (HISTCOUNTER));
+  p->textsize = p->highpc - p->lowpc;
+  p->kcountsize = ROUNDUP (p->textsize / HISTFRACTION, sizeof (*p->kcount));
+
+  narcs = p->textsize / 100 * ARCDENSITY;
+  if (narcs < MINARCS)
+    narcs = MINARCS;
+  else if (narcs > MAXARCS)
+    narcs = MAXARCS;
+  /* Keep the table at most half full so that probe sequences stay
+     short.  */
+  for (nslots = 1; nslots < 2 * narcs; nslots <<= 1)
+    ;
+  arcsize = nslots * sizeof (struct gmonarc);
+
+  cp = calloc (1, arcsize + p->kcountsize);
+  if (cp == NULL)
+    {
+      ERR ("monstartup: out of memory\n");
+      p->state = GMON_PROF_ERROR;
+      return;
+    }
+  p->arcs = (struct gmonarc *) cp;
+  p->arcmask = nslots - 1;
+  p->narcs = 0;
+  p->dropped = 0;
+  p->kcount = (u_short *) (cp + arcsize);
+  p->profrate = __profile_frequency ();
+
+  if (p->kcountsize < p->textsize)
+    s_scale = ((unsigned long long) p->kcountsize * SCALE_1_TO_1)
+	      / p->textsize;
+  else
+    s_scale = SCALE_1_TO_1;
+
+  moncontrol (1);
+}
+
+void
+monstartup (u_long lowpc, u_long highpc)
+{
+  __monstartup (lowpc, highpc);
+}
+
+/*
+ * Control profiling
+ *	profiling is what mcount checks to see if
+ *	all the data structures are ready.
+ */
+void
+moncontrol (int mode)
+{
+  struct gmonparam *p = &_gmonparam;
+
+  /* Don't change the state if we ran into an error.  */
+  if (p->state == GMON_PROF_ERROR)
+    return;
+
+  if (mode)
+    {
+      /* start */
+      profil (p->kcount, p->kcountsize, p->lowpc, s_scale);
+      p->state = GMON_PROF_ON;
+    }
+  else
+    {
+      /* stop */
+      profil (NULL, 0, 0, 0);
+      p->state = GMON_PROF_OFF;
+    }
+}
+
+static void
+write_hist (int fd)
+{
+  struct gmonparam *p = &_gmonparam;
+  u_char tag = GMON_TAG_TIME_HIST;
+  struct gmon_hist_hdr hdr;
+  char *lowpc = (char *) p->lowpc;
+  char *highpc = (char *) p->highpc;
+  int32_t size = p->kcountsize / sizeof (HISTCOUNTER);
+  int32_t rate = p->profrate;
+
+  memcpy (hdr.low_pc, &lowpc, sizeof (hdr.low_pc));
+  memcpy (hdr.high_pc, &highpc, sizeof (hdr.high_pc));
+  memcpy (hdr.hist_size, &size, sizeof (hdr.hist_size));
+  memcpy (hdr.prof_rate, &rate, sizeof (hdr.prof_rate));
+  strncpy (hdr.dimen, "seconds", sizeof (hdr.dimen));
+  hdr.dimen_abbrev = 's';
+
+  write (fd, &tag, sizeof (tag));
+  write (fd, &hdr, sizeof (hdr));
+  write (fd, p->kcount, p->kcountsize);
+}
+
+/* Arc records are written in batches of this many.  */
+#define NARCS_PER_WRITE	64
+
+static void
+write_call_graph (int fd)
+{
+  struct gmonparam *p = &_gmonparam;
+  struct {
+    u_char tag;
+    struct gmon_cg_arc_record rec;
+  } __attribute__ ((packed)) buf[NARCS_PER_WRITE];
+  u_long i;
+  int n = 0;
+
+  for (i = 0; i <= p->arcmask; i++)
+    {
+      struct gmonarc *arc = &p->arcs[i];
+      char *frompc, *selfpc;
+      long count;
+      int32_t count32;
+
+      if (arc->selfpc == 0 || arc->selfpc == ARC_BUSY)
+	continue;
+      frompc = (char *) arc->frompc;
+      selfpc = (char *) arc->selfpc;
+      /* The record holds 32 bits; saturate rather than wrap.  */
+      count = arc->count;
+      count32 = count > 0x7fffffffL ? 0x7fffffff : (int32_t) count;
+
+      buf[n].tag = GMON_TAG_CG_ARC;
+      memcpy (buf[n].rec.from_pc, &frompc, sizeof (buf[n].rec.from_pc));
+      memcpy (buf[n].rec.self_pc, &selfpc, sizeof (buf[n].rec.self_pc));
+      memcpy (buf[n].rec.count, &count32, sizeof (buf[n].rec.count));
+      if (++n == NARCS_PER_WRITE)
+	{
+	  write (fd, buf, n * sizeof (buf[0]));
+	  n = 0;
+	}
+    }
+  if (n > 0)
+    write (fd, buf, n * sizeof (buf[0]));
+}
+
+void
+_mcleanup (void)
+{
+  struct gmonparam *p = &_gmonparam;
+  struct gmon_hdr ghdr;
+  int32_t version = GMON_VERSION;
+  const char *filename = "gmon.out";
+  char *prefix;
+  char buf[PATH_MAX];
+  int fd;
+
+  if (p->kcount == NULL)
+    return;
+
+  moncontrol (0);
+
+  if (p->dropped != 0)
+    ERR ("_mcleanup: arc table overflow, call graph incomplete\n");
+
+  /* Like glibc: if GMON_OUT_PREFIX is set, write to $GMON_OUT_PREFIX.pid
+     so that the profiles of several processes don't overwrite each
+     other.  */
+  if ((prefix = getenv ("GMON_OUT_PREFIX")) != NULL && *prefix != '\0')
+    {
+      snprintf (buf, sizeof (buf), "%s.%u", prefix, (unsigned) getpid ());
+      filename = buf;
+    }
+
+  fd = open (filename, O_CREAT | O_TRUNC | O_WRONLY, 0666);
+  if (fd < 0)
+    {
+      perror (filename);
+      return;
+    }
+
+  memset (&ghdr, 0, sizeof (ghdr));
+  memcpy (ghdr.cookie, GMON_MAGIC, sizeof (ghdr.cookie));
+  memcpy (ghdr.version, &version, sizeof (ghdr.version));
+  write (fd, &ghdr, sizeof (ghdr));
+
+  write_hist (fd);
+  write_call_graph (fd);
+
+  close (fd);
+
+  free (p->arcs);
+  p->arcs = NULL;
+  p->kcount = NULL;
+}
+
+/* Called by crt0 if the program contains code compiled with -pg (which
+   references mcount and thereby pulls in this file).  Profile the whole
+   text segment of the executable.  */
+
+extern char __executable_start, etext;
+
+void
+__gmon_start__ (void)
+{
+  static int called;
+
+  if (called)
+    return;
+  called = 1;
+
+  __monstartup ((u_long) &__executable_start, (u_long) &etext);
+  atexit (_mcleanup);
+}
@@ -183,7 +183,7 @@ struct mallinfo {
   int hblks;    /* number of mmapped regions */
   int hblkhd;   /* total space in mmapped regions */
   int usmblks;  /* unused -- always zero */
-  int fsmblks;  /* unused -- always zero */
+  int fsmblks;  /* free space handed back to the system by madvise */
   int uordblks; /* total allocated space */
   int fordblks; /* total non-inuse space */
   int keepcost; /* top-most, releasable (via malloc_trim) space */
@@ -213,6 +213,7 @@ extern struct mallinfo _mallinfo_r __MALLOC_P ((struct _reent *__r));
 #define M_MMAP_THRESHOLD    -3
 #define M_MMAP_MAX          -4
 #define M_CHECK_ACTION      -5
+#define M_DECAY_TIME        -6
 
 /* General SVID/XPG interface to tunable parameters. */
 extern int mallopt __MALLOC_P ((int __param, int __val));
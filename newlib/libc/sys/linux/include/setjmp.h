@@ -34,6 +34,11 @@ int	sigsetjmp (sigjmp_buf __jmpb, int __savemask);
                    (sigprocmask (SIG_BLOCK, NULL, &__jmpb.__saved_mask) == 0), \
                     setjmp (__jmpb.__buf) )
 
+/* _setjmp and _longjmp never save or restore the signal mask.  */
+
+#define _setjmp(__jmpb)			setjmp (__jmpb)
+#define _longjmp(__jmpb, __retval)	longjmp (__jmpb, __retval)
+
 #ifdef __cplusplus
 }
 #endif
@@ -190,6 +190,11 @@ int nanosleep (const struct timespec  *rqtp, struct timespec *rmtp);
 
 #define CLOCK_REALTIME (clockid_t)1
 
+/* Time since some unspecified point, which setting the time of day does
+   not change.  */
+
+#define CLOCK_MONOTONIC (clockid_t)4
+
 /* Flag indicating time is "absolute" with respect to the clock
    associated with a time.  */
 
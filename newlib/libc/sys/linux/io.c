@@ -19,11 +19,12 @@
 #define __NR___ioctl __NR_ioctl
 #define __NR___flock __NR_flock
 #define __NR___mknod __NR_mknod
+#define __NR___sys_close __NR_close
 
 _syscall3(ssize_t,read,int,fd,void *,buf,size_t,count)
 _syscall3(ssize_t,write,int,fd,const void *,buf,size_t,count)
 _syscall3(int,open,const char *,file,int,flag,mode_t,mode)
-_syscall1(int,close,int,fd)
+static _syscall1(int,__sys_close,int,fd)
 _syscall3(off_t,lseek,int,fd,off_t,offset,int,count)
 _syscall0(int,sync)
 _syscall1(int,dup,int,fd)
@@ -56,6 +57,18 @@ int ioctl(int fd,int request,...)
     return res;
 }
 
+/* kqueue keeps a table for each kqueue descriptor, see event.c.  It is
+   only linked in with kqueue.  */
+extern void __kqueue_close (int) __attribute__ ((weak));
+
+int __libc_close(int fd)
+{
+    if (__kqueue_close)
+        __kqueue_close(fd);
+    return __sys_close(fd);
+}
+weak_alias(__libc_close,close);
+
 static _syscall2(long,__flock,unsigned int,fd,unsigned int,cmd)
 
 int flock(int fd,int operation)
@@ -12,8 +12,7 @@ extern void __libc_init_secure (void);
 /* This function will be called from _init in init-first.c.  */
 extern void __libc_global_ctors (void);
 
-/* Discover the tick frequency of the machine if something goes wrong,
-   we return 0, an impossible hertz.  */
+/* Discover the tick frequency of the machine, used as profiling rate.  */
 extern int __profile_frequency (void);
 
 /* Hooks for the instrumenting functions.  */
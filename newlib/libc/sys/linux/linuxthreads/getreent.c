@@ -9,3 +9,12 @@ __getreent (void)
   return THREAD_GETMEM(self, p_reentp);
 }
 
+
+/* set thread-specific reentrant pointer */
+
+void
+__setreent (struct _reent *r)
+{
+  pthread_descr self = thread_self();
+  THREAD_SETMEM(self, p_reentp, r);
+}
@@ -19,6 +19,14 @@ extern int main(int argc,char **argv,char **envp);
 extern char _end;
 extern char __bss_start;
 
+/* Defined in gmon.c, which is linked in if any object was compiled
+   with -pg.  */
+extern void __gmon_start__ (void) __attribute__ ((weak));
+
+/* Defined in pinit.c, and only linked in if the program has parallel
+   constructors.  */
+extern void __libc_parallel_init (void) __attribute__ ((weak));
+
 void _start(int args)
 {
     /*
@@ -41,5 +49,12 @@ void _start(int args)
      *       by this time by Linux.  */
 
     tzset(); /* initialize timezone info */
+
+    if (__gmon_start__)
+      __gmon_start__ (); /* start profiling */
+
+    if (__libc_parallel_init)
+      __libc_parallel_init (); /* run parallel constructors */
+
     exit(main(argc,argv,environ));
 }
@@ -323,6 +323,7 @@ extern char* getenv();
 
 #include <libc-symbols.h>
 #include <sys/types.h>
+#include <time.h>
 
 extern void __pthread_initialize (void) __attribute__((weak));
 extern void *__mmap (void *__addr, size_t __len, int __prot,
@@ -330,6 +331,8 @@ extern void *__mmap (void *__addr, size_t __len, int __prot,
 extern int __munmap (void *__addr, size_t __len);
 extern void *__mremap (void *__addr, size_t __old_len, size_t __new_len,
                        int __may_move);
+extern int __madvise (void *__addr, size_t __len, int __advice);
+extern int __clock_gettime (clockid_t __clock_id, struct timespec *__tp);
 extern int __getpagesize (void);
 
 #define __libc_enable_secure 1
@@ -354,6 +357,7 @@ extern "C" {
 
 #include <errno.h>
 #include <stdio.h>    /* needed for malloc_stats */
+#include <sys/_tracepoint.h>
 
 
 /*
@@ -591,6 +595,9 @@ do {                                                                          \
 #if !defined(MAP_FAILED)
 #define MAP_FAILED ((char*)-1)
 #endif
+#ifndef MADV_DONTNEED
+#define MADV_DONTNEED 4
+#endif
 
 #ifndef MAP_NORESERVE
 # ifdef MAP_AUTORESRV
@@ -860,6 +867,32 @@ do {                                                                          \
 
 
 
+#ifndef DEFAULT_DECAY_TIME
+#if HAVE_MMAP
+#define DEFAULT_DECAY_TIME (1000)
+#else
+#define DEFAULT_DECAY_TIME (-1)
+#endif
+#endif
+
+/*
+    M_DECAY_TIME is the number of milliseconds an arena may hold more
+      than M_TRIM_THRESHOLD bytes of freshly freed memory before the
+      whole pages inside its large free chunks are handed back to the
+      system with madvise(MADV_DONTNEED).  The chunks stay where they
+      are, so a later malloc gets the same addresses back as zero-filled
+      pages.  This lets the resident size of a program follow its live
+      data even when the free space is not at the top of the heap and
+      so cannot be trimmed.
+
+      The arena is only looked at from malloc and free, and the clock
+      only read every PURGE_TICKS calls, so the delay is approximate.
+      Setting it to 0 purges as soon as the threshold is reached; -1
+      disables purging except through malloc_trim.
+*/
+
+
+
 #define HEAP_MIN_SIZE (32*1024)
 #define HEAP_MAX_SIZE (1024*1024) /* must be a power of two */
 
@@ -928,6 +961,8 @@ static size_t __libc_pagesize;
 #define mmap    __mmap
 #define munmap  __munmap
 #define mremap  __mremap
+#define madvise __madvise
+#define clock_gettime __clock_gettime
 #define mprotect __mprotect
 #undef malloc_getpagesize
 #define malloc_getpagesize __libc_pagesize
@@ -1242,6 +1277,10 @@ typedef struct _arena {
   long stat_lock_direct, stat_lock_loop, stat_lock_wait;
 #endif
   mutex_t mutex;
+  size_t dirty;               /* bytes freed into large chunks since the
+                                 last purge */
+  unsigned long dirty_since;  /* when dirty passed trim_threshold, in ms */
+  unsigned int purge_tick;    /* calls since then, 0 if not yet timed */
 } arena;
 
 
@@ -1258,6 +1297,43 @@ typedef struct _heap_info {
 } heap_info;
 
 
+/*
+  Purging free pages (see M_DECAY_TIME).  A free chunk whose pages have
+  been given back is stamped in the word after its fd and bk pointers,
+  so it is skipped by later purges until a free merges into it again.
+  Only the pages after that word and before the next chunk are
+  released, leaving the chunk headers alone.
+*/
+
+#define PURGE_MIN_SIZE  (4 * malloc_getpagesize)
+#define PURGE_MAGIC     ((unsigned long)0x70757267)
+#define PURGE_TICKS     64
+
+#define purge_stamp(p)  (*(unsigned long *)((char *)(p) + 4*SIZE_SZ))
+#define purge_mark(p)   ((unsigned long)(p) ^ PURGE_MAGIC)
+#define purge_start(p) \
+ ((char *)(((unsigned long)(p) + 4*SIZE_SZ + sizeof(unsigned long) + \
+            malloc_getpagesize - 1) & ~(malloc_getpagesize - 1)))
+#define purge_end(p) \
+ ((char *)(((unsigned long)(p) + chunksize(p)) & ~(malloc_getpagesize - 1)))
+
+/* The part of a purged chunk that a split leaves free only holds pages
+   that are still released past its own stamp, so it is purged too. */
+
+#define purge_split(victim, rem, rem_size)                                    \
+do {                                                                          \
+  if ((unsigned long)(rem_size) >= PURGE_MIN_SIZE &&                          \
+      purge_stamp(victim) == purge_mark(victim))                              \
+    purge_stamp(rem) = purge_mark(rem);                                       \
+} while(0)
+
+#if !HAVE_MMAP
+#define maybe_purge(ar_ptr)
+#undef purge_split
+#define purge_split(victim, rem, rem_size)
+#endif
+
+
 /*
   Static functions (forward declarations)
 */
@@ -1276,6 +1352,10 @@ static int       main_trim(size_t pad) internal_function;
 #if USE_ARENAS
 static int       heap_trim(heap_info *heap, size_t pad) internal_function;
 #endif
+#if HAVE_MMAP
+static int       purge_arena(arena *ar_ptr) internal_function;
+static void      maybe_purge(arena *ar_ptr) internal_function;
+#endif
 #if defined _LIBC || defined MALLOC_HOOKS
 static Void_t*   malloc_check(size_t sz, const Void_t *caller);
 static void      free_check(Void_t* mem, const Void_t *caller);
@@ -1301,6 +1381,10 @@ static int       main_trim();
 #if USE_ARENAS
 static int       heap_trim();
 #endif
+#if HAVE_MMAP
+static int       purge_arena();
+static void      maybe_purge();
+#endif
 #if defined _LIBC || defined MALLOC_HOOKS
 static Void_t*   malloc_check();
 static void      free_check();
@@ -1583,6 +1667,7 @@ static unsigned long top_pad          = DEFAULT_TOP_PAD;
 static unsigned int  n_mmaps_max      = DEFAULT_MMAP_MAX;
 static unsigned long mmap_threshold   = DEFAULT_MMAP_THRESHOLD;
 static int           check_action     = DEFAULT_CHECK_ACTION;
+static int           decay_time       = DEFAULT_DECAY_TIME;
 
 /* The first value returned from sbrk */
 static char* sbrk_base = (char*)(-1);
@@ -1824,6 +1909,10 @@ ptmalloc_init __MALLOC_P((void))
 	      if (! secure && memcmp (envline, "MMAP_MAX_", 9) == 0)
 		mALLOPt(M_MMAP_MAX, atoi(&envline[10]));
 	      break;
+	    case 11:
+	      if (! secure && memcmp (envline, "DECAY_TIME_", 11) == 0)
+		mALLOPt(M_DECAY_TIME, atoi(&envline[12]));
+	      break;
 	    case 15:
 	      if (! secure)
 		{
@@ -1849,6 +1938,8 @@ ptmalloc_init __MALLOC_P((void))
 	mALLOPt(M_MMAP_THRESHOLD, atoi(s));
       if((s = getenv("MALLOC_MMAP_MAX_")))
 	mALLOPt(M_MMAP_MAX, atoi(s));
+      if((s = getenv("MALLOC_DECAY_TIME_")))
+	mALLOPt(M_DECAY_TIME, atoi(s));
     }
   s = getenv("MALLOC_CHECK_");
 #endif
@@ -2806,6 +2897,12 @@ malloc_extend_top(ar_ptr, nb) arena *ar_ptr; INTERNAL_SIZE_T nb;
 
 */
 
+/* Return P from mALLOc, firing the malloc_return tracepoint. */
+
+#define MALLOC_RETURN(p) \
+  do { Void_t* ret_ = (p); \
+       __TRACEPOINT2(malloc_return, bytes, ret_); return ret_; } while (0)
+
 #if __STD_C
 Void_t* mALLOc(size_t bytes)
 #else
@@ -2831,11 +2928,13 @@ Void_t* mALLOc(bytes) size_t bytes;
   }
 #endif
 
+  __TRACEPOINT1(malloc_entry, bytes);
+
   if(request2size(bytes, nb))
-    return 0;
+    MALLOC_RETURN(0);
   arena_get(ar_ptr, nb);
   if(!ar_ptr)
-    return 0;
+    MALLOC_RETURN(0);
   victim = chunk_alloc(ar_ptr, nb);
   if(!victim) {
     /* Maybe the failure is due to running out of mmapped areas. */
@@ -2855,10 +2954,10 @@ Void_t* mALLOc(bytes) size_t bytes;
       }
 #endif
     }
-    if(!victim) return 0;
+    if(!victim) MALLOC_RETURN(0);
   } else
     (void)mutex_unlock(&ar_ptr->mutex);
-  return BOUNDED_N(chunk2mem(victim), bytes);
+  MALLOC_RETURN(BOUNDED_N(chunk2mem(victim), bytes));
 }
 
 static mchunkptr
@@ -2882,6 +2981,7 @@ chunk_alloc(ar_ptr, nb) arena *ar_ptr; INTERNAL_SIZE_T nb;
   mchunkptr bck;                     /* misc temp for linking */
   mbinptr q;                         /* misc temp */
 
+  maybe_purge(ar_ptr);
 
   /* Check for exact match in a bin */
 
@@ -2951,6 +3051,7 @@ chunk_alloc(ar_ptr, nb) arena *ar_ptr; INTERNAL_SIZE_T nb;
     if (remainder_size >= (long)MINSIZE) /* re-split */
     {
       remainder = chunk_at_offset(victim, nb);
+      purge_split(victim, remainder, remainder_size);
       set_head(victim, nb | PREV_INUSE);
       link_last_remainder(ar_ptr, remainder);
       set_head(remainder, remainder_size | PREV_INUSE);
@@ -3014,6 +3115,7 @@ chunk_alloc(ar_ptr, nb) arena *ar_ptr; INTERNAL_SIZE_T nb;
           if (remainder_size >= (long)MINSIZE) /* split */
           {
             remainder = chunk_at_offset(victim, nb);
+            purge_split(victim, remainder, remainder_size);
             set_head(victim, nb | PREV_INUSE);
             unlink(victim, bck, fwd);
             link_last_remainder(ar_ptr, remainder);
@@ -3158,12 +3260,15 @@ void fREe(mem) Void_t* mem;
   if (mem == 0)                              /* free(0) has no effect */
     return;
 
+  __TRACEPOINT1(free_entry, mem);
+
   p = mem2chunk(mem);
 
 #if HAVE_MMAP
   if (chunk_is_mmapped(p))                       /* release mmapped memory. */
   {
     munmap_chunk(p);
+    __TRACEPOINT1(free_return, mem);
     return;
   }
 #endif
@@ -3181,6 +3286,7 @@ void fREe(mem) Void_t* mem;
 #endif
   chunk_free(ar_ptr, p);
   (void)mutex_unlock(&ar_ptr->mutex);
+  __TRACEPOINT1(free_return, mem);
 }
 
 static void
@@ -3239,6 +3345,7 @@ chunk_free(ar_ptr, p) arena *ar_ptr; mchunkptr p;
         heap_trim(heap, top_pad);
     }
 #endif
+    maybe_purge(ar_ptr);
     return;
   }
 
@@ -3279,6 +3386,12 @@ chunk_free(ar_ptr, p) arena *ar_ptr; mchunkptr p;
   if (!islr)
     frontlink(ar_ptr, p, sz, idx, bck, fwd);
 
+  if (sz >= PURGE_MIN_SIZE)                  /* pages may be dirty again */
+  {
+    purge_stamp(p) = 0;
+    ar_ptr->dirty += hd & ~PREV_INUSE;
+  }
+
 #if USE_ARENAS
   /* Check whether the heap containing top can go away now. */
   if(next->size < MINSIZE &&
@@ -3291,6 +3404,7 @@ chunk_free(ar_ptr, p) arena *ar_ptr; mchunkptr p;
       heap_trim(heap, top_pad);
   }
 #endif
+  maybe_purge(ar_ptr);
 }
 
 
@@ -3942,7 +4056,8 @@ void cfree(mem) Void_t *mem;
     of a program. However, it cannot guarantee to reduce memory. Under
     some allocation patterns, some large free blocks of memory will be
     locked between two used chunks, so they cannot be given back to
-    the system.
+    the system.  The whole pages inside such blocks are released with
+    madvise instead, in every arena, whatever M_DECAY_TIME says.
 
     The `pad' argument to malloc_trim represents the amount of free
     trailing space to leave untrimmed. If this argument is zero,
@@ -3963,10 +4078,22 @@ int mALLOC_TRIm(pad) size_t pad;
 #endif
 {
   int res;
+#if HAVE_MMAP
+  arena *ar_ptr;
+#endif
 
   (void)mutex_lock(&main_arena.mutex);
   res = main_trim(pad);
   (void)mutex_unlock(&main_arena.mutex);
+#if HAVE_MMAP
+  for(ar_ptr = &main_arena;;) {
+    (void)mutex_lock(&ar_ptr->mutex);
+    res |= purge_arena(ar_ptr);
+    (void)mutex_unlock(&ar_ptr->mutex);
+    ar_ptr = ar_ptr->next;
+    if(ar_ptr == &main_arena) break;
+  }
+#endif
   return res;
 }
 
@@ -4089,6 +4216,92 @@ heap_trim(heap, pad) heap_info *heap; size_t pad;
 
 #endif /* USE_ARENAS */
 
+#if HAVE_MMAP
+
+static int
+#if __STD_C
+purge_chunk(mchunkptr p)
+#else
+purge_chunk(p) mchunkptr p;
+#endif
+{
+  char *start;
+
+  if (chunksize(p) < PURGE_MIN_SIZE || purge_stamp(p) == purge_mark(p))
+    return 0;
+  start = purge_start(p);
+  if (madvise(start, purge_end(p) - start, MADV_DONTNEED) != 0)
+    return 0;
+  purge_stamp(p) = purge_mark(p);
+  return 1;
+}
+
+/* Release the whole pages inside the large free chunks of an arena,
+   including the last remainder, which a run of small requests may have
+   carved out of a big chunk.  The caller holds the arena lock. */
+
+static int
+internal_function
+#if __STD_C
+purge_arena(arena *ar_ptr)
+#else
+purge_arena(ar_ptr) arena *ar_ptr;
+#endif
+{
+  int i, res = 0;
+  mbinptr b;
+  mchunkptr p;
+
+  b = last_remainder(ar_ptr);
+  if (last(b) != b)
+    res |= purge_chunk(last(b));
+  for (i = bin_index(PURGE_MIN_SIZE); i < NAV; ++i)
+  {
+    b = bin_at(ar_ptr, i);
+    for (p = last(b); p != b; p = p->bk)
+      res |= purge_chunk(p);
+  }
+  ar_ptr->dirty = 0;
+  ar_ptr->purge_tick = 0;
+  return res;
+}
+
+/* Called from malloc and free with the arena locked.  Once dirty has
+   passed trim_threshold, note the time, and purge when decay_time has
+   gone by; the clock is only read every PURGE_TICKS calls. */
+
+static void
+internal_function
+#if __STD_C
+maybe_purge(arena *ar_ptr)
+#else
+maybe_purge(ar_ptr) arena *ar_ptr;
+#endif
+{
+  struct timespec ts;
+  unsigned long now;
+
+  if (decay_time < 0 || ar_ptr->dirty < trim_threshold)
+    return;
+  if (decay_time > 0)
+  {
+    if (ar_ptr->purge_tick++ % PURGE_TICKS != 0)
+      return;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    now = ts.tv_sec * 1000UL + ts.tv_nsec / 1000000;
+    if (ar_ptr->purge_tick == 1)
+    {
+      ar_ptr->dirty_since = now;
+      return;
+    }
+    if (now - ar_ptr->dirty_since < (unsigned long)decay_time)
+      return;
+  }
+  purge_arena(ar_ptr);
+}
+
+#endif /* HAVE_MMAP */
+
 
 
 /*
@@ -4144,6 +4357,7 @@ malloc_update_mallinfo(ar_ptr, mi) arena *ar_ptr; struct mallinfo *mi;
   mchunkptr q;
 #endif
   INTERNAL_SIZE_T avail;
+  INTERNAL_SIZE_T released = 0;
 
   (void)mutex_lock(&ar_ptr->mutex);
   avail = chunksize(top(ar_ptr));
@@ -4163,12 +4377,15 @@ malloc_update_mallinfo(ar_ptr, mi) arena *ar_ptr; struct mallinfo *mi;
 #endif
       avail += chunksize(p);
       navail++;
+      if (chunksize(p) >= PURGE_MIN_SIZE && purge_stamp(p) == purge_mark(p))
+        released += purge_end(p) - purge_start(p);
     }
   }
 
   mi->arena = ar_ptr->size;
   mi->ordblks = navail;
-  mi->smblks = mi->usmblks = mi->fsmblks = 0; /* clear unused fields */
+  mi->smblks = mi->usmblks = 0; /* clear unused fields */
+  mi->fsmblks = released;
   mi->uordblks = ar_ptr->size - avail;
   mi->fordblks = avail;
   mi->hblks = n_mmaps;
@@ -4237,7 +4454,7 @@ void mALLOC_STATs()
   int i;
   arena *ar_ptr;
   struct mallinfo mi;
-  unsigned int in_use_b = mmapped_mem, system_b = in_use_b;
+  unsigned int in_use_b = mmapped_mem, system_b = in_use_b, released_b = 0;
 #if THREAD_STATS
   long stat_lock_direct = 0, stat_lock_loop = 0, stat_lock_wait = 0;
 #endif
@@ -4247,8 +4464,10 @@ void mALLOC_STATs()
     fprintf(stderr, "Arena %d:\n", i);
     fprintf(stderr, "system bytes     = %10u\n", (unsigned int)mi.arena);
     fprintf(stderr, "in use bytes     = %10u\n", (unsigned int)mi.uordblks);
+    fprintf(stderr, "released bytes   = %10u\n", (unsigned int)mi.fsmblks);
     system_b += mi.arena;
     in_use_b += mi.uordblks;
+    released_b += mi.fsmblks;
 #if THREAD_STATS
     stat_lock_direct += ar_ptr->stat_lock_direct;
     stat_lock_loop += ar_ptr->stat_lock_loop;
@@ -4273,6 +4492,7 @@ void mALLOC_STATs()
 #endif
   fprintf(stderr, "system bytes     = %10u\n", system_b);
   fprintf(stderr, "in use bytes     = %10u\n", in_use_b);
+  fprintf(stderr, "released bytes   = %10u\n", released_b);
 #ifdef NO_THREADS
   fprintf(stderr, "max system bytes = %10u\n", (unsigned int)max_total_mem);
 #endif
@@ -4351,6 +4571,13 @@ int mALLOPt(param_number, value) int param_number; int value;
 #endif
     case M_CHECK_ACTION:
       check_action = value; return 1;
+    case M_DECAY_TIME:
+#if HAVE_MMAP
+      if (value < -1) return 0;
+      decay_time = value; return 1;
+#else
+      if (value != -1) return 0; else decay_time = value; return 1;
+#endif
 
     default:
       return 0;
@@ -0,0 +1,119 @@
+/* libc/sys/linux/mcount.c - call graph recording for gprof */
+
+/* Every function compiled with -pg calls mcount from its prologue.  The
+   assembly stub below passes the return address into the calling function
+   (selfpc) and the return address of that function (frompc) to
+   mcount_internal, which counts the arc frompc -> selfpc.
+
+   Arcs live in an open addressed hash table.  A free slot is claimed by
+   switching its selfpc from 0 to ARC_BUSY with compare-and-swap; the
+   claiming thread then fills in frompc and count and publishes the slot
+   by storing the real selfpc.  Counting an existing arc is a single
+   atomic increment, so threads never wait for each other.  A thread that
+   finds a slot still ARC_BUSY simply probes on; at worst this records the
+   same arc twice, which gprof sums when reading gmon.out.  */
+
+#include <sys/types.h>
+#include <sys/gmon.h>
+
+static void mcount_internal (u_long, u_long)
+#if defined (__i386__)
+  __attribute__ ((regparm (2)))
+#endif
+  __attribute__ ((used));
+
+#if defined (__i386__)
+/* Called after the frame pointer has been set up; %eax, %ecx and %edx
+   may hold arguments of regparm functions and must be preserved.  */
+__asm__ ("\
+	.text\n\
+	.globl	_mcount\n\
+	.type	_mcount,@function\n\
+	.weak	mcount\n\
+	mcount = _mcount\n\
+_mcount:\n\
+	pushl	%eax\n\
+	pushl	%ecx\n\
+	pushl	%edx\n\
+	movl	12(%esp),%edx\n\
+	movl	4(%ebp),%eax\n\
+	call	mcount_internal\n\
+	popl	%edx\n\
+	popl	%ecx\n\
+	popl	%eax\n\
+	ret\n\
+	.size	_mcount,.-_mcount\n\
+");
+#elif defined (__x86_64__)
+/* Called after the frame pointer has been set up; preserve the argument
+   registers.  */
+__asm__ ("\
+	.text\n\
+	.globl	_mcount\n\
+	.type	_mcount,@function\n\
+	.weak	mcount\n\
+	mcount = _mcount\n\
+_mcount:\n\
+	subq	$56,%rsp\n\
+	movq	%rax,(%rsp)\n\
+	movq	%rcx,8(%rsp)\n\
+	movq	%rdx,16(%rsp)\n\
+	movq	%rsi,24(%rsp)\n\
+	movq	%rdi,32(%rsp)\n\
+	movq	%r8,40(%rsp)\n\
+	movq	%r9,48(%rsp)\n\
+	movq	56(%rsp),%rsi\n\
+	movq	8(%rbp),%rdi\n\
+	call	mcount_internal\n\
+	movq	48(%rsp),%r9\n\
+	movq	40(%rsp),%r8\n\
+	movq	32(%rsp),%rdi\n\
+	movq	24(%rsp),%rsi\n\
+	movq	16(%rsp),%rdx\n\
+	movq	8(%rsp),%rcx\n\
+	movq	(%rsp),%rax\n\
+	addq	$56,%rsp\n\
+	ret\n\
+	.size	_mcount,.-_mcount\n\
+");
+#else
+# error "mcount: no entry point for this machine"
+#endif
+
+static void
+mcount_internal (u_long frompc, u_long selfpc)
+{
+  struct gmonparam *p = &_gmonparam;
+  struct gmonarc *arc;
+  u_long h, i, s;
+
+  if (p->state != GMON_PROF_ON)
+    return;
+
+  /* Signal handlers get called from the stack, not from text space.  */
+  if (frompc - p->lowpc > p->textsize)
+    return;
+
+  h = (frompc ^ (selfpc * 0x9e3779b1UL)) >> 2;
+  for (i = 0; i < ARCPROBES; i++)
+    {
+      arc = &p->arcs[(h + i) & p->arcmask];
+      s = arc->selfpc;
+      if (s == selfpc && arc->frompc == frompc)
+	{
+	  __sync_fetch_and_add (&arc->count, 1);
+	  return;
+	}
+      if (s == 0
+	  && __sync_bool_compare_and_swap (&arc->selfpc, 0, ARC_BUSY))
+	{
+	  arc->frompc = frompc;
+	  arc->count = 1;
+	  __sync_synchronize ();
+	  arc->selfpc = selfpc;
+	  __sync_fetch_and_add (&p->narcs, 1);
+	  return;
+	}
+    }
+  __sync_fetch_and_add (&p->dropped, 1);
+}
@@ -0,0 +1,185 @@
+/* libc/sys/linux/pinit.c - Run parallel constructors */
+
+/* See <sys/pinit.h>.  The PARALLEL_CONSTRUCTOR descriptors are collected
+   by the linker in the __libc_pinit section, whose bounds it provides as
+   __start___libc_pinit and __stop___libc_pinit.  crt0 calls
+   __libc_parallel_init just before main.  */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <sys/pinit.h>
+
+#define DEFAULT_THREADS	4
+#define MAX_THREADS	64
+
+extern const struct __pinit *__start___libc_pinit[] __attribute__ ((weak));
+extern const struct __pinit *__stop___libc_pinit[] __attribute__ ((weak));
+
+struct pinit_job {
+  const struct __pinit *desc;
+  unsigned long usecs;			/* run time, if timing */
+};
+
+struct pinit_batch {
+  struct pinit_job *jobs;
+  int njobs;
+  volatile int next;			/* next job to be taken */
+  int timing;
+};
+
+static unsigned long
+now_usecs (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return tv.tv_sec * 1000000UL + tv.tv_usec;
+}
+
+static void *
+pinit_worker (void *arg)
+{
+  struct pinit_batch *b = arg;
+  struct pinit_job *job;
+  unsigned long start;
+  int i;
+
+  while ((i = __sync_fetch_and_add (&b->next, 1)) < b->njobs)
+    {
+      job = &b->jobs[i];
+      if (b->timing)
+	{
+	  start = now_usecs ();
+	  job->desc->__fn ();
+	  job->usecs = now_usecs () - start;
+	}
+      else
+	job->desc->__fn ();
+    }
+  return NULL;
+}
+
+/* Run the jobs of one level on up to NTHREADS threads, including the
+   calling one.  If a thread cannot be created, the remaining threads
+   (at least the calling one) simply take more jobs.  */
+
+static void
+run_batch (struct pinit_batch *b, int nthreads)
+{
+  pthread_t tids[MAX_THREADS];
+  int i, n = 0;
+
+  if (nthreads > b->njobs)
+    nthreads = b->njobs;
+  for (i = 1; i < nthreads; i++)
+    if (pthread_create (&tids[n], NULL, pinit_worker, b) == 0)
+      n++;
+  pinit_worker (b);
+  for (i = 0; i < n; i++)
+    pthread_join (tids[i], NULL);
+}
+
+/* Without memory for the jobs, still run them all on the calling
+   thread, level by level and in link order within a level.  */
+
+static void
+run_serial (size_t count)
+{
+  int level = 0, next = 0, started = 0, found;
+  size_t i;
+
+  for (;;)
+    {
+      /* The lowest level above the one just run.  */
+      found = 0;
+      for (i = 0; i < count; i++)
+	{
+	  int l = __start___libc_pinit[i]->__level;
+
+	  if ((!started || l > level) && (!found || l < next))
+	    {
+	      next = l;
+	      found = 1;
+	    }
+	}
+      if (!found)
+	break;
+      for (i = 0; i < count; i++)
+	if (__start___libc_pinit[i]->__level == next)
+	  __start___libc_pinit[i]->__fn ();
+      level = next;
+      started = 1;
+    }
+}
+
+void
+__libc_parallel_init (void)
+{
+  size_t count = __stop___libc_pinit - __start___libc_pinit;
+  struct pinit_job *jobs;
+  struct pinit_batch b;
+  unsigned long start = 0;
+  const char *s;
+  int nthreads, timing;
+  size_t i, j, first;
+
+  if (count == 0)
+    return;
+
+  nthreads = DEFAULT_THREADS;
+  if ((s = getenv ("NEWLIB_PINIT_THREADS")) != NULL && *s != '\0')
+    nthreads = atoi (s);
+  if (nthreads < 1)
+    nthreads = 1;
+  else if (nthreads > MAX_THREADS)
+    nthreads = MAX_THREADS;
+  timing = getenv ("NEWLIB_PINIT_TIMING") != NULL;
+
+  jobs = calloc (count, sizeof *jobs);
+  if (jobs == NULL)
+    {
+      run_serial (count);
+      return;
+    }
+
+  /* Sort by level.  Insertion sort keeps link order within a level,
+     which makes runs with a single thread reproducible.  */
+  for (i = 0; i < count; i++)
+    {
+      const struct __pinit *d = __start___libc_pinit[i];
+
+      for (j = i; j > 0 && jobs[j - 1].desc->__level > d->__level; j--)
+	jobs[j] = jobs[j - 1];
+      jobs[j].desc = d;
+    }
+
+  if (timing)
+    start = now_usecs ();
+
+  b.timing = timing;
+  for (first = 0; first < count; first = i)
+    {
+      for (i = first + 1;
+	   i < count && jobs[i].desc->__level == jobs[first].desc->__level;
+	   i++)
+	;
+      b.jobs = &jobs[first];
+      b.njobs = i - first;
+      b.next = 0;
+      run_batch (&b, nthreads);
+    }
+
+  if (timing)
+    {
+      fprintf (stderr, "pinit: %lu constructors, %d threads, %lu us\n",
+	       (unsigned long) count, nthreads, now_usecs () - start);
+      for (i = 0; i < count; i++)
+	fprintf (stderr, "pinit: level %d %s: %lu us\n",
+		 jobs[i].desc->__level, jobs[i].desc->__name, jobs[i].usecs);
+    }
+
+  free (jobs);
+}
@@ -33,22 +33,34 @@
 #include <sys/time.h>
 #include <libc-internal.h>
 
+/* Fallback used when the kernel reports no timer granularity, as is
+   the case with high resolution timers.  ITIMER_PROF is still driven by
+   the scheduler tick, so use the traditional profiling clock rate.  */
+#define PROF_HZ 100
+
 int
 __profile_frequency (void)
 {
   /*
-   * Discover the tick frequency of the machine if something goes wrong,
-   * we return 0, an impossible hertz.
+   * Discover the tick frequency of the machine.  The result is cached
+   * since profil and the gmon.out writer both need it and must agree.
    */
+  static int freq;
   struct itimerval tim;
 
+  if (freq != 0)
+    return freq;
+
   tim.it_interval.tv_sec = 0;
   tim.it_interval.tv_usec = 1;
   tim.it_value.tv_sec = 0;
   tim.it_value.tv_usec = 0;
   setitimer(ITIMER_REAL, &tim, 0);
   setitimer(ITIMER_REAL, 0, &tim);
-  if (tim.it_interval.tv_usec < 2)
-    return 0;
-  return (1000000 / tim.it_interval.tv_usec);
+  if (tim.it_interval.tv_usec < 1000000 / 1000
+      || tim.it_interval.tv_usec > 1000000 / 10)
+    freq = PROF_HZ;
+  else
+    freq = 1000000 / tim.it_interval.tv_usec;
+  return freq;
 }
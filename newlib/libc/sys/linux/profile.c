@@ -1,12 +1,110 @@
-/* libc/sys/linux/profile.c - profiling system call */
+/* libc/sys/linux/profile.c - PC sampling for profil(3) */
+
+/* Linux has no profil system call, so emulate it: an ITIMER_PROF interval
+   timer delivers SIGPROF while the process consumes CPU time, and the
+   handler adds one tick to the histogram bucket of the interrupted PC.  */
 
 #include <errno.h>
+#include <signal.h>
+#include <stddef.h>
 #include <sys/types.h>
-#include <machine/syscall.h>
-
-#define __NR_profil 98
+#include <sys/time.h>
+#include <asm/sigcontext.h>
+#include <libc-internal.h>
 
 int  profil(u_short  *buf,  size_t  bufsiz, size_t offset,
             u_int scale);
 
-_syscall4(int,profil,unsigned short *,buf,size_t,bufsiz,size_t,offset,unsigned int, scale)
+#if defined (__i386__)
+# define GET_PC(ctx)	((size_t) (ctx)->eip)
+#elif defined (__x86_64__)
+# define GET_PC(ctx)	((size_t) (ctx)->rip)
+#else
+# error "profil: don't know how to find the interrupted PC"
+#endif
+
+/* The context the kernel passes to a SA_SIGINFO handler.  Only the
+   machine context is of interest here.  */
+struct kernel_ucontext {
+  unsigned long uc_flags;
+  struct kernel_ucontext *uc_link;
+  struct {
+    void *ss_sp;
+    int ss_flags;
+    size_t ss_size;
+  } uc_stack;
+  struct sigcontext uc_mcontext;
+};
+
+static u_short *samples;
+static size_t nsamples;
+static size_t pc_offset;
+static u_int pc_scale;
+
+static struct sigaction oact;
+static struct itimerval otimer;
+
+static void
+profil_counter (int signo, siginfo_t *si, void *uc)
+{
+  size_t i = (GET_PC (&((struct kernel_ucontext *) uc)->uc_mcontext)
+	      - pc_offset) / 2;
+
+  /* i * pc_scale / 65536 without overflowing size_t.  */
+  i = i / 65536 * pc_scale + i % 65536 * pc_scale / 65536;
+  if (i < nsamples)
+    ++samples[i];
+}
+
+int
+profil (u_short *buf, size_t bufsiz, size_t offset, u_int scale)
+{
+  struct sigaction act;
+  struct itimerval timer;
+
+  if (buf == NULL || scale == 0)
+    {
+      /* Stop sampling and restore what we found at startup.  */
+      if (samples == NULL)
+	return 0;
+      samples = NULL;
+      if (setitimer (ITIMER_PROF, &otimer, NULL) < 0)
+	return -1;
+      return sigaction (SIGPROF, &oact, NULL);
+    }
+
+  if (samples != NULL)
+    {
+      /* Already sampling; just switch to the new buffer.  */
+      samples = buf;
+      nsamples = bufsiz / sizeof *buf;
+      pc_offset = offset;
+      pc_scale = scale;
+      return 0;
+    }
+
+  samples = buf;
+  nsamples = bufsiz / sizeof *buf;
+  pc_offset = offset;
+  pc_scale = scale;
+
+  act.sa_sigaction = profil_counter;
+  act.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigfillset (&act.sa_mask);
+  if (sigaction (SIGPROF, &act, &oact) < 0)
+    {
+      samples = NULL;
+      return -1;
+    }
+
+  timer.it_value.tv_sec = 0;
+  timer.it_value.tv_usec = 1000000 / __profile_frequency ();
+  timer.it_interval = timer.it_value;
+  if (setitimer (ITIMER_PROF, &timer, &otimer) < 0)
+    {
+      sigaction (SIGPROF, &oact, NULL);
+      samples = NULL;
+      return -1;
+    }
+  return 0;
+}
@@ -0,0 +1,51 @@
+/* libc/sys/linux/sys/epoll.h - I/O event notification */
+
+#ifndef _SYS_EPOLL_H
+#define _SYS_EPOLL_H
+
+#include <_ansi.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+#define EPOLLIN		0x001
+#define EPOLLPRI	0x002
+#define EPOLLOUT	0x004
+#define EPOLLERR	0x008
+#define EPOLLHUP	0x010
+#define EPOLLRDHUP	0x2000
+#define EPOLLONESHOT	(1U << 30)
+#define EPOLLET		(1U << 31)
+
+#define EPOLL_CTL_ADD	1
+#define EPOLL_CTL_DEL	2
+#define EPOLL_CTL_MOD	3
+
+#define EPOLL_CLOEXEC	02000000	/* same as O_CLOEXEC */
+
+typedef union epoll_data {
+  void *ptr;
+  int fd;
+  __uint32_t u32;
+  __uint64_t u64;
+} epoll_data_t;
+
+/* The kernel packs this structure on x86_64 only.  */
+struct epoll_event {
+  __uint32_t events;
+  epoll_data_t data;
+}
+#ifdef __x86_64__
+__attribute__ ((__packed__))
+#endif
+;
+
+int epoll_create (int size);
+int epoll_create1 (int flags);
+int epoll_ctl (int epfd, int op, int fd, struct epoll_event *event);
+int epoll_wait (int epfd, struct epoll_event *events, int maxevents,
+		int timeout);
+
+_END_STD_C
+
+#endif /* _SYS_EPOLL_H */
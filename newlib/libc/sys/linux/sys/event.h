@@ -29,6 +29,8 @@
 #ifndef _SYS_EVENT_H_
 #define _SYS_EVENT_H_
 
+#include <sys/types.h>
+
 #define EVFILT_READ		(-1)
 #define EVFILT_WRITE		(-2)
 #define EVFILT_AIO		(-3)	/* attached to aio requests */
@@ -50,11 +52,11 @@
 } while(0)
 
 struct kevent {
-	unsigned int *	ident;		/* identifier for this event */
+	uintptr_t	ident;		/* identifier for this event */
 	short		filter;		/* filter for event */
 	u_short		flags;
 	u_int		fflags;
-        int * 	        data;
+	intptr_t	data;
 	void		*udata;		/* opaque user data identifier */
 };
 
@@ -181,6 +183,17 @@ extern int	kqueue_del_filteropts(int filt);
 
 #else 	/* !_KERNEL */
 
+/*
+ * On Linux, kqueue and kevent are implemented in the C library on top of
+ * epoll.  EVFILT_READ and EVFILT_WRITE work on any descriptor epoll
+ * accepts; EVFILT_TIMER takes a period in milliseconds in data and is
+ * backed by a timerfd on CLOCK_MONOTONIC.
+ * The other filters fail with EINVAL.  EV_CLEAR maps to edge triggering,
+ * which epoll applies to a whole descriptor, so it only takes effect when
+ * every filter on the descriptor requests it.  The data field of read and
+ * write events is always 0.  The timerfds of a kqueue are closed by the
+ * first call to kqueue after the kqueue itself is closed.
+ */
 #include <sys/cdefs.h>
 struct timespec;
 
@@ -0,0 +1,53 @@
+/* libc/sys/linux/sys/fiber.h - Cooperative user-space fibers */
+
+/* A fiber is a function running on its own stack, switched to and from
+   explicitly by the program rather than preempted.  Each fiber has its
+   own struct _reent, which is made current whenever the fiber runs, so
+   errno, the stdio streams, strtok and the other per-thread library
+   state of one fiber are not disturbed by another.
+
+   fiber_create makes a new fiber runnable; it starts the next time the
+   creating fiber gives up the processor.  fiber_yield puts the calling
+   fiber at the end of the run queue and runs the first one, fiber_switch
+   runs the given runnable fiber at once.  A fiber ends by returning from
+   its function; fiber_join waits for that, collects the return value and
+   frees the stack.  The code that first calls any of these functions
+   becomes the main fiber, which cannot be joined.
+
+   fiber_wait_fd parks the calling fiber until FD is ready for any of
+   EVENTS (EPOLLIN, EPOLLOUT, ...), running other fibers in the meantime,
+   and returns the events that occurred, or -1 with errno set.  When no
+   fiber is runnable the process sleeps in epoll_wait until one is.
+
+   Stacks are mapped on demand with an inaccessible guard page below
+   them, so an overflow faults instead of corrupting memory.  A
+   STACKSIZE of 0 selects FIBER_STACK_DEFAULT.
+
+   The other functions return 0 or an error number, like the pthread
+   functions.  Fibers are not thread safe: all fibers of a process must
+   be created and run by the same thread.  */
+
+#ifndef _SYS_FIBER_H
+#define _SYS_FIBER_H
+
+#include <_ansi.h>
+#include <sys/types.h>
+#include <sys/epoll.h>
+
+_BEGIN_STD_C
+
+#define FIBER_STACK_DEFAULT	(64 * 1024)
+
+typedef struct __fiber *fiber_t;
+
+int fiber_create (fiber_t *fiber, size_t stacksize,
+		  void *(*fn) (void *), void *arg);
+int fiber_join (fiber_t fiber, void **retval);
+int fiber_switch (fiber_t fiber);
+void fiber_yield (void);
+fiber_t fiber_self (void);
+int fiber_wait_fd (int fd, int events);
+
+_END_STD_C
+
+#endif /* _SYS_FIBER_H */
@@ -0,0 +1,93 @@
+/* libc/sys/linux/sys/gmon.h - gprof profiling runtime */
+
+/* The layout of the histogram and of the arcs written to gmon.out follows
+   the BSD and GNU conventions, see <sys/gmon_out.h>, so that the output
+   can be read by stock gprof.  Call graph arcs are kept in an open
+   addressed hash table which mcount updates without taking any lock.  */
+
+#ifndef _SYS_GMON_H
+#define _SYS_GMON_H
+
+#include <sys/types.h>
+
+/* Histogram counters are unsigned shorts (according to the kernel).  */
+#define HISTCOUNTER	unsigned short
+
+/* Fraction of text space to allocate for histogram counters here, 1/2.  */
+#define HISTFRACTION	2
+
+/* Fraction of text space to allocate for from hash buckets.  Only used
+   by the shared object profiler in dl-profile.c.  */
+#define HASHFRACTION	2
+
+/* Percent of text space to allocate for arcs, with a minimum and a
+   maximum.  The arc table is rounded up to a power of two.  */
+#define ARCDENSITY	3
+#define MINARCS		50
+#define MAXARCS		(1 << 20)
+
+/* Maximum number of slots probed in the arc table before an arc is
+   dropped.  */
+#define ARCPROBES	32
+
+/* A call graph arc: the calling site, the called function and the number
+   of traversals.  A slot is free while its selfpc is 0 and is being
+   filled in while its selfpc is ARC_BUSY.  */
+struct gmonarc {
+	volatile u_long	frompc;
+	volatile u_long	selfpc;
+	volatile long	count;
+};
+#define ARC_BUSY	((u_long) 1)
+
+/* General rounding functions.  */
+#define ROUNDDOWN(x,y)	(((x)/(y))*(y))
+#define ROUNDUP(x,y)	((((x)+(y)-1)/(y))*(y))
+
+/* The profiling data structures are housed in this structure.  */
+struct gmonparam {
+	volatile long	state;
+	u_short		*kcount;
+	u_long		kcountsize;
+	struct gmonarc	*arcs;
+	u_long		arcmask;	/* number of arc slots - 1 */
+	volatile u_long	narcs;		/* arc slots in use */
+	volatile u_long	dropped;	/* arcs dropped, table too full */
+	u_long		lowpc;
+	u_long		highpc;
+	u_long		textsize;
+	int		profrate;	/* histogram samples per second */
+};
+extern struct gmonparam _gmonparam;
+
+/* Possible states of profiling.  */
+#define	GMON_PROF_ON	0
+#define	GMON_PROF_BUSY	1
+#define	GMON_PROF_ERROR	2
+#define	GMON_PROF_OFF	3
+
+#include <_ansi.h>
+
+_BEGIN_STD_C
+
+/* Set up data structures and start profiling of [LOWPC, HIGHPC).  */
+extern void __monstartup (u_long __lowpc, u_long __highpc);
+extern void monstartup (u_long __lowpc, u_long __highpc);
+
+/* Stop or restart profiling.  */
+extern void moncontrol (int __mode);
+
+/* Stop profiling and write gmon.out.  */
+extern void _mcleanup (void);
+
+/* Called from the startup code when the program is linked with objects
+   compiled with -pg.  */
+extern void __gmon_start__ (void);
+
+/* Collect a PC histogram of the calling process, see profil(3).  */
+extern int profil (u_short *__sample_buffer, size_t __size,
+		   size_t __offset, u_int __scale);
+
+_END_STD_C
+
+#endif /* _SYS_GMON_H */
@@ -0,0 +1,48 @@
+/* libc/sys/linux/sys/gmon_out.h - gmon.out file format */
+
+/* This is the tagged file format introduced by GNU gprof.  The file
+   starts with a struct gmon_hdr, followed by any number of records,
+   each introduced by a one byte tag.  */
+
+#ifndef _SYS_GMON_OUT_H
+#define _SYS_GMON_OUT_H
+
+#define	GMON_MAGIC	"gmon"	/* magic cookie */
+#define GMON_VERSION	1	/* version number */
+
+/* For profiling shared libraries, see dl-profile.c.  */
+#define GMON_SHOBJ_VERSION	0x1ffff
+
+struct gmon_hdr
+{
+  char cookie[4];
+  char version[4];
+  char spare[3 * 4];
+};
+
+/* Types of records in this file.  */
+typedef enum
+{
+  GMON_TAG_TIME_HIST = 0,
+  GMON_TAG_CG_ARC = 1,
+  GMON_TAG_BB_COUNT = 2
+} GMON_Record_Tag;
+
+struct gmon_hist_hdr
+{
+  char low_pc[sizeof (char *)];	/* base pc address of sample buffer */
+  char high_pc[sizeof (char *)];	/* max pc address of sampled buffer */
+  char hist_size[4];		/* size of sample buffer */
+  char prof_rate[4];		/* profiling clock rate */
+  char dimen[15];		/* phys. dim., usually "seconds" */
+  char dimen_abbrev;		/* usually 's' for "second" */
+};
+
+struct gmon_cg_arc_record
+{
+  char from_pc[sizeof (char *)];	/* address within caller's body */
+  char self_pc[sizeof (char *)];	/* address within callee's body */
+  char count[4];			/* number of arc traversals */
+};
+
+#endif /* _SYS_GMON_OUT_H */
@@ -11,6 +11,7 @@
 #endif
 
 #include <bits/libc-lock.h>
+#include <sys/_tracepoint.h>
 
 typedef __libc_lock_t _LOCK_T;
 typedef __libc_lock_recursive_t _LOCK_RECURSIVE_T;
@@ -22,8 +23,23 @@ typedef __libc_lock_recursive_t _LOCK_RECURSIVE_T;
 
 #define __lock_init(__lock) __libc_lock_init(__lock)
 #define __lock_init_recursive(__lock) __libc_lock_init_recursive(__lock)
+#ifdef __TRACEPOINTS_ENABLED
+/* Try the lock first so that waiting for a lock held by another thread
+   shows up as a lock_contended/lock_acquired pair of tracepoints.  */
+#define __lock_acquire(__lock) \
+  __extension__ ({ if (__libc_lock_trylock(__lock) != 0) \
+	{ __TRACEPOINT1(lock_contended, &(__lock)); \
+	  __libc_lock_lock(__lock); \
+	  __TRACEPOINT1(lock_acquired, &(__lock)); } })
+#define __lock_acquire_recursive(__lock) \
+  __extension__ ({ if (__libc_lock_trylock_recursive(__lock) != 0) \
+	{ __TRACEPOINT1(lock_contended, &(__lock)); \
+	  __libc_lock_lock_recursive(__lock); \
+	  __TRACEPOINT1(lock_acquired, &(__lock)); } })
+#else
 #define __lock_acquire(__lock) __libc_lock_lock(__lock)
 #define __lock_acquire_recursive(__lock) __libc_lock_lock_recursive(__lock)
+#endif
 #define __lock_release(__lock) __libc_lock_unlock(__lock)
 #define __lock_release_recursive(__lock) __libc_lock_unlock_recursive(__lock)
 #define __lock_try_acquire(__lock) __libc_lock_trylock(__lock)
@@ -0,0 +1,51 @@
+/* libc/sys/linux/sys/pinit.h - Parallel constructors */
+
+/* A function defined with
+
+     PARALLEL_CONSTRUCTOR (build_tables, 0)
+     {
+       ...
+     }
+
+   runs before main like a constructor, but on a small pool of threads
+   alongside the other parallel constructors of the same level.  Levels
+   run in increasing order, each one after all constructors of the
+   previous level have returned, so a parallel constructor may depend on
+   those of lower levels.  Within a level no order is guaranteed.
+
+   The startup code runs parallel constructors just before main, so
+   ordinary constructors must not depend on them.  They must be thread
+   safe with respect to each other.
+
+   The environment variable NEWLIB_PINIT_THREADS sets the number of
+   threads used (default 4, 1 runs everything on the initial thread).  If
+   NEWLIB_PINIT_TIMING is set, the run time of each parallel constructor
+   is reported on stderr.  */
+
+#ifndef _SYS_PINIT_H
+#define _SYS_PINIT_H
+
+#include <_ansi.h>
+
+_BEGIN_STD_C
+
+struct __pinit {
+  void (*__fn) (void);
+  const char *__name;
+  int __level;
+  void (*__run) (void);		/* pulls in the runtime */
+};
+
+extern void __libc_parallel_init (void);
+
+#define PARALLEL_CONSTRUCTOR(fn, level) \
+  static void fn (void); \
+  static const struct __pinit __pinit_##fn = \
+    { fn, #fn, (level), __libc_parallel_init }; \
+  static const struct __pinit *__pinit_ptr_##fn \
+    __attribute__ ((__section__ ("__libc_pinit"), __used__)) = &__pinit_##fn; \
+  static void fn (void)
+
+_END_STD_C
+
+#endif /* _SYS_PINIT_H */
@@ -0,0 +1,24 @@
+/* libc/sys/linux/sys/timerfd.h - Timers readable through a descriptor */
+
+#ifndef _SYS_TIMERFD_H
+#define _SYS_TIMERFD_H
+
+#include <_ansi.h>
+#include <sys/types.h>
+#include <time.h>
+
+_BEGIN_STD_C
+
+#define TFD_CLOEXEC		02000000	/* same as O_CLOEXEC */
+#define TFD_NONBLOCK		04000		/* same as O_NONBLOCK */
+
+#define TFD_TIMER_ABSTIME	1
+
+int timerfd_create (clockid_t clock_id, int flags);
+int timerfd_settime (int fd, int flags, const struct itimerspec *value,
+		     struct itimerspec *ovalue);
+int timerfd_gettime (int fd, struct itimerspec *value);
+
+_END_STD_C
+
+#endif /* _SYS_TIMERFD_H */
@@ -0,0 +1,33 @@
+/* libc/sys/linux/timerfd.c - Timers readable through a descriptor */
+
+#include <errno.h>
+#include <time.h>
+#include <sys/timerfd.h>
+#include <machine/syscall.h>
+
+/* The kernel numbers its clocks differently from <time.h>.  */
+#define LINUX_CLOCK_REALTIME	0
+#define LINUX_CLOCK_MONOTONIC	1
+
+#define __NR___timerfd_create __NR_timerfd_create
+
+static _syscall2(int,__timerfd_create,int,clock_id,int,flags);
+_syscall4(int,timerfd_settime,int,fd,int,flags,const struct itimerspec *,value,struct itimerspec *,ovalue);
+_syscall2(int,timerfd_gettime,int,fd,struct itimerspec *,value);
+
+int
+timerfd_create (clockid_t clock_id, int flags)
+{
+  switch (clock_id)
+    {
+    case CLOCK_REALTIME:
+      return __timerfd_create (LINUX_CLOCK_REALTIME, flags);
+#ifdef CLOCK_MONOTONIC
+    case CLOCK_MONOTONIC:
+      return __timerfd_create (LINUX_CLOCK_MONOTONIC, flags);
+#endif
+    default:
+      errno = EINVAL;
+      return -1;
+    }
+}
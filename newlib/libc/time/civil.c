@@ -0,0 +1,179 @@
+/*
+ * civil.c
+ * Original Author: Adapted from civil_from_days() and days_from_civil()
+ * by Howard Hinnant, see
+ * http://howardhinnant.github.io/date_algorithms.html
+ * Modifications:
+ * - civil_from_days() moved here from gmtime_r() and shared with mktime(),
+ *   timegm() and strptime().
+ *
+ * Constant time conversions between the proleptic Gregorian calendar and
+ * a count of days since 1970-01-01, and the normalization of a broken-down
+ * time used by mktime() and timegm().
+ */
+
+#include <stdlib.h>
+#include "local.h"
+
+/* Move epoch from 01.01.1970 to 01.03.0000 (yes, Year 0) - this is the first
+ * day of a 400-year long "era", right after additional day of leap year.
+ * This adjustment is required only for date calculation, so instead of
+ * modifying time_t value (which would require 64-bit operations to work
+ * correctly) it's enough to adjust the calculated number of days since epoch.
+ */
+#define EPOCH_ADJUSTMENT_DAYS	719468L
+/* year to which the adjustment was made */
+#define ADJUSTED_EPOCH_YEAR	0
+/* 1st March of year 0 is Wednesday */
+#define ADJUSTED_EPOCH_WDAY	3
+/* there are 97 leap years in 400-year periods. ((400 - 97) * 365 + 97 * 366) */
+#define DAYS_PER_ERA		146097L
+/* there are 24 leap years in 100-year periods. ((100 - 24) * 365 + 24 * 366) */
+#define DAYS_PER_CENTURY	36524L
+/* there is one leap year every 4 years */
+#define DAYS_PER_4_YEARS	(3 * 365 + 366)
+/* number of days in a non-leap year */
+#define DAYS_PER_YEAR		365
+/* number of days in January */
+#define DAYS_IN_JANUARY		31
+/* number of days in non-leap February */
+#define DAYS_IN_FEBRUARY	28
+/* number of years per era */
+#define YEARS_PER_ERA		400
+
+/* Return the number of days from 1970-01-01 to MDAY of month MON [0, 11]
+   of YEAR (not relative to 1900).  MDAY may be out of range, day 0 being
+   the last day of the previous month.  */
+long
+__days_from_civil (int year, int mon, int mday)
+{
+  int era;
+  unsigned erayear, yearday;
+  unsigned long eraday;
+
+  /* count years from March, so that the leap day is the last one */
+  if (mon < 2)
+    year--;
+  era = (year >= 0 ? year : year - (YEARS_PER_ERA - 1)) / YEARS_PER_ERA;
+  erayear = year - era * YEARS_PER_ERA;	/* [0, 399] */
+  yearday = (153 * (mon < 2 ? mon + 10 : mon - 2) + 2) / 5;	/* [0, 337] */
+  eraday = DAYS_PER_YEAR * erayear + erayear / 4 - erayear / 100 +
+      yearday;	/* [0, 146096] */
+
+  return era * DAYS_PER_ERA + (long) eraday - EPOCH_ADJUSTMENT_DAYS +
+      (mday - 1);
+}
+
+/* Set tm_year, tm_mon, tm_mday, tm_yday and tm_wday of RES from the
+   number of days since 1970-01-01.  */
+void
+__civil_from_days (long days, struct tm *res)
+{
+  int era, weekday, year;
+  unsigned erayear, yearday, month, day;
+  unsigned long eraday;
+
+  days += EPOCH_ADJUSTMENT_DAYS;
+
+  /* compute day of week */
+  if ((weekday = ((ADJUSTED_EPOCH_WDAY + days) % DAYSPERWEEK)) < 0)
+    weekday += DAYSPERWEEK;
+  res->tm_wday = weekday;
+
+  /* compute year, month, day & day of year */
+  era = (days >= 0 ? days : days - (DAYS_PER_ERA - 1)) / DAYS_PER_ERA;
+  eraday = days - era * DAYS_PER_ERA;	/* [0, 146096] */
+  erayear = (eraday - eraday / (DAYS_PER_4_YEARS - 1) + eraday / DAYS_PER_CENTURY -
+      eraday / (DAYS_PER_ERA - 1)) / 365;	/* [0, 399] */
+  yearday = eraday - (DAYS_PER_YEAR * erayear + erayear / 4 - erayear / 100);	/* [0, 365] */
+  month = (5 * yearday + 2) / 153;	/* [0, 11] */
+  day = yearday - (153 * month + 2) / 5 + 1;	/* [1, 31] */
+  month += month < 10 ? 2 : -10;
+  year = ADJUSTED_EPOCH_YEAR + erayear + era * YEARS_PER_ERA + (month <= 1);
+
+  res->tm_yday = yearday >= DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY ?
+      yearday - (DAYS_PER_YEAR - DAYS_IN_JANUARY - DAYS_IN_FEBRUARY) :
+      yearday + DAYS_IN_JANUARY + DAYS_IN_FEBRUARY + isleap(erayear);
+  res->tm_year = year - YEAR_BASE;
+  res->tm_mon = month;
+  res->tm_mday = day;
+}
+
+/* Bring every field of TIM_P but tm_isdst into its normal range, carrying
+   into the next larger unit, and set tm_yday and tm_wday.  */
+void
+__normalize_tm (struct tm *tim_p)
+{
+  div_t res;
+  int era, year;
+  long days;
+
+  /* calculate time & date to account for out of range values */
+  if (tim_p->tm_sec < 0 || tim_p->tm_sec > 59)
+    {
+      res = div (tim_p->tm_sec, 60);
+      tim_p->tm_min += res.quot;
+      if ((tim_p->tm_sec = res.rem) < 0)
+	{
+	  tim_p->tm_sec += 60;
+	  --tim_p->tm_min;
+	}
+    }
+
+  if (tim_p->tm_min < 0 || tim_p->tm_min > 59)
+    {
+      res = div (tim_p->tm_min, 60);
+      tim_p->tm_hour += res.quot;
+      if ((tim_p->tm_min = res.rem) < 0)
+	{
+	  tim_p->tm_min += 60;
+	  --tim_p->tm_hour;
+        }
+    }
+
+  if (tim_p->tm_hour < 0 || tim_p->tm_hour > 23)
+    {
+      res = div (tim_p->tm_hour, 24);
+      tim_p->tm_mday += res.quot;
+      if ((tim_p->tm_hour = res.rem) < 0)
+	{
+	  tim_p->tm_hour += 24;
+	  --tim_p->tm_mday;
+        }
+    }
+
+  if (tim_p->tm_mon < 0 || tim_p->tm_mon > 11)
+    {
+      res = div (tim_p->tm_mon, 12);
+      tim_p->tm_year += res.quot;
+      if ((tim_p->tm_mon = res.rem) < 0)
+        {
+	  tim_p->tm_mon += 12;
+	  --tim_p->tm_year;
+        }
+    }
+
+  /* A 400-year era has a whole number of weeks, so take whole eras out of
+     tm_year and tm_mday first.  This keeps the day count small whatever
+     the input, and the era is added back to the year at the end.  */
+  res = div (tim_p->tm_year, YEARS_PER_ERA);
+  if (res.rem < 0)
+    {
+      res.rem += YEARS_PER_ERA;
+      --res.quot;
+    }
+  era = res.quot;
+  year = res.rem + YEAR_BASE;
+
+  res = div (tim_p->tm_mday - 1, DAYS_PER_ERA);
+  if (res.rem < 0)
+    {
+      res.rem += DAYS_PER_ERA;
+      --res.quot;
+    }
+  era += res.quot;
+
+  days = __days_from_civil (year, tim_p->tm_mon, 1) + res.rem;
+  __civil_from_days (days, tim_p);
+  tim_p->tm_year += era * YEARS_PER_ERA;
+}
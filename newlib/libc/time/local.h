@@ -21,6 +21,10 @@
 
 int         __tzcalc_limits (int __year);
 
+long        __days_from_civil (int __year, int __mon, int __mday);
+void        __civil_from_days (long __days, struct tm *__res);
+void        __normalize_tm (struct tm *__tim_p);
+
 extern const int __month_lengths[2][MONSPERYEAR];
 
 void _tzset_unlocked_r (struct _reent *);
@@ -11,6 +11,7 @@
  * represented, returns the value (time_t) -1.
  *
  * Modifications:	Fixed tm_isdst usage - 27 August 2008 Craig Howland.
+ *			Constant time date arithmetic, see civil.c.
  */
 
 /*
@@ -50,145 +51,30 @@ ANSI C requires <<mktime>>.
 #define _SEC_IN_HOUR 3600L
 #define _SEC_IN_DAY 86400L
 
-static const int DAYS_IN_MONTH[12] =
-{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-
-#define _DAYS_IN_MONTH(x) ((x == 1) ? days_in_feb : DAYS_IN_MONTH[x])
-
-static const int _DAYS_BEFORE_MONTH[12] =
-{0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
-
-#define _ISLEAP(y) (((y) % 4) == 0 && (((y) % 100) != 0 || (((y)+1900) % 400) == 0))
-#define _DAYS_IN_YEAR(year) (_ISLEAP(year) ? 366 : 365)
-
-static void 
-validate_structure (struct tm *tim_p)
-{
-  div_t res;
-  int days_in_feb = 28;
-
-  /* calculate time & date to account for out of range values */
-  if (tim_p->tm_sec < 0 || tim_p->tm_sec > 59)
-    {
-      res = div (tim_p->tm_sec, 60);
-      tim_p->tm_min += res.quot;
-      if ((tim_p->tm_sec = res.rem) < 0)
-	{
-	  tim_p->tm_sec += 60;
-	  --tim_p->tm_min;
-	}
-    }
-
-  if (tim_p->tm_min < 0 || tim_p->tm_min > 59)
-    {
-      res = div (tim_p->tm_min, 60);
-      tim_p->tm_hour += res.quot;
-      if ((tim_p->tm_min = res.rem) < 0)
-	{
-	  tim_p->tm_min += 60;
-	  --tim_p->tm_hour;
-        }
-    }
-
-  if (tim_p->tm_hour < 0 || tim_p->tm_hour > 23)
-    {
-      res = div (tim_p->tm_hour, 24);
-      tim_p->tm_mday += res.quot;
-      if ((tim_p->tm_hour = res.rem) < 0)
-	{
-	  tim_p->tm_hour += 24;
-	  --tim_p->tm_mday;
-        }
-    }
-
-  if (tim_p->tm_mon < 0 || tim_p->tm_mon > 11)
-    {
-      res = div (tim_p->tm_mon, 12);
-      tim_p->tm_year += res.quot;
-      if ((tim_p->tm_mon = res.rem) < 0)
-        {
-	  tim_p->tm_mon += 12;
-	  --tim_p->tm_year;
-        }
-    }
-
-  if (_DAYS_IN_YEAR (tim_p->tm_year) == 366)
-    days_in_feb = 29;
-
-  if (tim_p->tm_mday <= 0)
-    {
-      while (tim_p->tm_mday <= 0)
-	{
-	  if (--tim_p->tm_mon == -1)
-	    {
-	      tim_p->tm_year--;
-	      tim_p->tm_mon = 11;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
-	  tim_p->tm_mday += _DAYS_IN_MONTH (tim_p->tm_mon);
-	}
-    }
-  else
-    {
-      while (tim_p->tm_mday > _DAYS_IN_MONTH (tim_p->tm_mon))
-	{
-	  tim_p->tm_mday -= _DAYS_IN_MONTH (tim_p->tm_mon);
-	  if (++tim_p->tm_mon == 12)
-	    {
-	      tim_p->tm_year++;
-	      tim_p->tm_mon = 0;
-	      days_in_feb =
-		((_DAYS_IN_YEAR (tim_p->tm_year) == 366) ?
-		 29 : 28);
-	    }
-	}
-    }
-}
-
 time_t 
 mktime (struct tm *tim_p)
 {
   time_t tim = 0;
-  long days = 0;
-  int year, isdst=0;
+  long days;
+  int isdst=0;
   __tzinfo_type *tz = __gettzinfo ();
 
-  /* validate structure */
-  validate_structure (tim_p);
+  /* validate structure, computing tm_yday and tm_wday */
+  __normalize_tm (tim_p);
 
   /* compute hours, minutes, seconds */
   tim += tim_p->tm_sec + (tim_p->tm_min * _SEC_IN_MINUTE) +
     (tim_p->tm_hour * _SEC_IN_HOUR);
 
-  /* compute days in year */
-  days += tim_p->tm_mday - 1;
-  days += _DAYS_BEFORE_MONTH[tim_p->tm_mon];
-  if (tim_p->tm_mon > 1 && _DAYS_IN_YEAR (tim_p->tm_year) == 366)
-    days++;
-
-  /* compute day of the year */
-  tim_p->tm_yday = days;
-
   if (tim_p->tm_year > 10000 || tim_p->tm_year < -10000)
       return (time_t) -1;
 
-  /* compute days in other years */
-  if ((year = tim_p->tm_year) > 70)
-    {
-      for (year = 70; year < tim_p->tm_year; year++)
-	days += _DAYS_IN_YEAR (year);
-    }
-  else if (year < 70)
-    {
-      for (year = 69; year > tim_p->tm_year; year--)
-	days -= _DAYS_IN_YEAR (year);
-      days -= _DAYS_IN_YEAR (year);
-    }
+  /* compute days since the epoch */
+  days = __days_from_civil (tim_p->tm_year + YEAR_BASE, tim_p->tm_mon,
+			    tim_p->tm_mday);
 
   /* compute total seconds */
-  tim += (days * _SEC_IN_DAY);
+  tim += (time_t) days * _SEC_IN_DAY;
 
   TZ_LOCK;
 
@@ -236,28 +122,8 @@ mktime (struct tm *tim_p)
 		    diff = -diff;
 		  tim_p->tm_sec += diff;
 		  tim += diff;  /* we also need to correct our current time calculation */
-		  int mday = tim_p->tm_mday;
-		  validate_structure (tim_p);
-		  mday = tim_p->tm_mday - mday;
-		  /* roll over occurred */
-		  if (mday) {
-		    /* compensate for month roll overs */
-		    if (mday > 1)
-			  mday = -1;
-		    else if (mday < -1)
-			  mday = 1;
-		    /* update days for wday calculation */
-		    days += mday;
-		    /* handle yday */
-		    if ((tim_p->tm_yday += mday) < 0) {
-			  --year;
-			  tim_p->tm_yday = _DAYS_IN_YEAR(year) - 1;
-		    } else {
-			  mday = _DAYS_IN_YEAR(year);
-			  if (tim_p->tm_yday > (mday - 1))
-				tim_p->tm_yday -= mday;
-		    }
-		  }
+		  /* renormalize, which also corrects tm_yday and tm_wday */
+		  __normalize_tm (tim_p);
 		}
 	    }
 	}
@@ -274,9 +140,5 @@ mktime (struct tm *tim_p)
   /* reset isdst flag to what we have calculated */
   tim_p->tm_isdst = isdst;
 
-  /* compute day of the week */
-  if ((tim_p->tm_wday = (days + 4) % 7) < 0)
-    tim_p->tm_wday += 7;
-	
   return tim;
 }
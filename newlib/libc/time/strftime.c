@@ -335,6 +335,10 @@ locale, hard-coding the "C" locale settings.
 
 #define CHECK_LENGTH()	if (len < 0 || (count += len) >= maxsize) \
 			  return 0
+#define PUT_CHAR(c)	if (count < maxsize - 1) \
+			  s[count++] = (c); \
+			else \
+			  return 0
 
 /* Enforce the coding assumptions that YEAR_BASE is positive.  (%C, %Y, etc.) */
 #if YEAR_BASE < 0
@@ -390,6 +394,49 @@ iso_year_adjust (const struct tm *tim_p)
 #undef PACK
 }
 
+/* Format VAL like printf's "%*.*u" with WIDTH and PREC, preceded by a
+   '-' if NEG, into BUF of BUFSIZ characters.  Return the length, or -1
+   if it does not leave room for the terminating NUL.  The numeric fields
+   are formatted with this instead of snprintf, which is by far the most
+   expensive part of a typical strftime call.  */
+static int
+conv_num (CHAR *buf, size_t bufsiz, int neg, unsigned val,
+	  unsigned long prec, unsigned long width)
+{
+  CHAR digits[sizeof (unsigned) * 3];
+  unsigned long zeros, spaces, len;
+  int n = 0;
+
+  while (val)
+    {
+      digits[n++] = CQ('0') + val % 10;
+      val /= 10;
+    }
+  zeros = prec > (unsigned long) n ? prec - n : 0;
+  len = neg + zeros + n;
+  spaces = width > len ? width - len : 0;
+  len += spaces;
+  if (len >= bufsiz)
+    return -1;
+  while (spaces--)
+    *buf++ = CQ(' ');
+  if (neg)
+    *buf++ = CQ('-');
+  while (zeros--)
+    *buf++ = CQ('0');
+  while (n)
+    *buf++ = digits[--n];
+  return (int) len;
+}
+
+/* conv_num for a signed VAL.  */
+static inline int
+conv_int (CHAR *buf, size_t bufsiz, int val, int prec, int width)
+{
+  return conv_num (buf, bufsiz, val < 0, val < 0 ? -(unsigned) val : val,
+		   prec, width);
+}
+
 #ifdef _WANT_C99_TIME_FORMATS
 typedef struct {
   int   year;
@@ -858,22 +905,18 @@ recurse:
 	    else
 #endif /* _WANT_C99_TIME_FORMATS */
 	      {
-		CHAR *fmt = CQ("%s%.*d");
-		char *pos = "";
 		int neg = tim_p->tm_year < -YEAR_BASE;
 		int century = tim_p->tm_year >= 0
 		  ? tim_p->tm_year / 100 + YEAR_BASE / 100
 		  : abs (tim_p->tm_year + YEAR_BASE) / 100;
-		if (pad) /* '0' or '+' */
-		  {
-		    fmt = CQ("%s%0.*d");
-		    if (century >= 100 && pad == CQ('+'))
-		      pos = "+";
-		  }
 		if (width < 2)
 		  width = 2;
-		len = snprintf (&s[count], maxsize - count, fmt,
-				neg ? "-" : pos, width - neg, century);
+		if (!neg && century >= 100 && pad == CQ('+'))
+		  {
+		    PUT_CHAR (CQ('+'));
+		  }
+		len = conv_num (&s[count], maxsize - count, neg, century,
+				width - neg, 0);
 	      }
             CHECK_LENGTH ();
 	  }
@@ -902,19 +945,24 @@ recurse:
 		break;
 	    }
 #endif /* _WANT_C99_TIME_FORMATS */
-	  len = snprintf (&s[count], maxsize - count,
-			  *format == CQ('d') ? CQ("%.2d") : CQ("%2d"),
-			  tim_p->tm_mday);
+	  if (*format == CQ('d'))
+	    len = conv_int (&s[count], maxsize - count, tim_p->tm_mday, 2, 0);
+	  else
+	    len = conv_int (&s[count], maxsize - count, tim_p->tm_mday, 1, 2);
 	  CHECK_LENGTH ();
 	  break;
 	case CQ('D'):
 	  /* %m/%d/%y */
-	  len = snprintf (&s[count], maxsize - count,
-			  CQ("%.2d/%.2d/%.2d"),
-			  tim_p->tm_mon + 1, tim_p->tm_mday,
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_mon + 1, 2, 0);
+	  CHECK_LENGTH ();
+	  PUT_CHAR (CQ('/'));
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_mday, 2, 0);
+	  CHECK_LENGTH ();
+	  PUT_CHAR (CQ('/'));
+	  len = conv_int (&s[count], maxsize - count,
 			  tim_p->tm_year >= 0 ? tim_p->tm_year % 100
-			  : abs (tim_p->tm_year + YEAR_BASE) % 100);
-          CHECK_LENGTH ();
+			  : abs (tim_p->tm_year + YEAR_BASE) % 100, 2, 0);
+	  CHECK_LENGTH ();
 	  break;
 	case CQ('F'):
 	  { /* %F is equivalent to "%+4Y-%m-%d", flags and width can change
@@ -957,8 +1005,8 @@ recurse:
 		adjust = 1;
 	    else if (adjust > 0 && tim_p->tm_year < -YEAR_BASE)
 		adjust = -1;
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    ((year + adjust) % 100 + 100) % 100);
+	    len = conv_int (&s[count], maxsize - count,
+			    ((year + adjust) % 100 + 100) % 100, 2, 0);
             CHECK_LENGTH ();
 	  }
           break;
@@ -989,25 +1037,19 @@ recurse:
 		year = 0;
 		++century;
 	      }
-	    CHAR fmtbuf[10], *fmt = fmtbuf;
 	    /* int potentially overflows, so use unsigned instead.  */
 	    unsigned p_year = century * 100 + year;
 	    if (sign)
-	      *fmt++ = CQ('-');
+	      PUT_CHAR (CQ('-'));
 	    else if (pad == CQ('+') && p_year >= 10000)
 	      {
-		*fmt++ = CQ('+');
+		PUT_CHAR (CQ('+'));
 		sign = 1;
 	      }
 	    if (width && sign)
 	      --width;
-	    *fmt++ = CQ('%');
-	    if (pad)
-	      *fmt++ = CQ('0');
-	    STRCPY (fmt, CQ(".*u"));
-	    len = snprintf (&s[count], maxsize - count, fmtbuf, width, p_year);
-            if (len < 0  ||  (count+=len) >= maxsize)
-              return 0;
+	    len = conv_num (&s[count], maxsize - count, 0, p_year, width, 0);
+	    CHECK_LENGTH ();
 	  }
           break;
 	case CQ('H'):
@@ -1023,9 +1065,10 @@ recurse:
 #endif /* _WANT_C99_TIME_FORMATS */
 	  /*FALLTHRU*/
 	case CQ('k'):	/* newlib extension */
-	  len = snprintf (&s[count], maxsize - count,
-			  *format == CQ('k') ? CQ("%2d") : CQ("%.2d"),
-			  tim_p->tm_hour);
+	  if (*format == CQ('k'))
+	    len = conv_int (&s[count], maxsize - count, tim_p->tm_hour, 1, 2);
+	  else
+	    len = conv_int (&s[count], maxsize - count, tim_p->tm_hour, 2, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('l'):	/* newlib extension */
@@ -1042,14 +1085,14 @@ recurse:
 		|| !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					       h12, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	      len = snprintf (&s[count], maxsize - count,
-			      *format == CQ('I') ? CQ("%.2d") : CQ("%2d"), h12);
+	      len = conv_int (&s[count], maxsize - count, h12,
+			      *format == CQ('I') ? 2 : 1,
+			      *format == CQ('I') ? 0 : 2);
 	    CHECK_LENGTH ();
 	  }
 	  break;
 	case CQ('j'):
-	  len = snprintf (&s[count], maxsize - count, CQ("%.3d"),
-			  tim_p->tm_yday + 1);
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_yday + 1, 3, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('m'):
@@ -1058,8 +1101,7 @@ recurse:
 	      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					     tim_p->tm_mon + 1, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    tim_p->tm_mon + 1);
+	    len = conv_int (&s[count], maxsize - count, tim_p->tm_mon + 1, 2, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('M'):
@@ -1068,8 +1110,7 @@ recurse:
 	      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					     tim_p->tm_min, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    tim_p->tm_min);
+	    len = conv_int (&s[count], maxsize - count, tim_p->tm_min, 2, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('n'):
@@ -1091,9 +1132,11 @@ recurse:
 	    }
 	  break;
 	case CQ('R'):
-          len = snprintf (&s[count], maxsize - count, CQ("%.2d:%.2d"),
-			  tim_p->tm_hour, tim_p->tm_min);
-          CHECK_LENGTH ();
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_hour, 2, 0);
+	  CHECK_LENGTH ();
+	  PUT_CHAR (CQ(':'));
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_min, 2, 0);
+	  CHECK_LENGTH ();
           break;
 	case CQ('s'):
 /*
@@ -1169,8 +1212,7 @@ recurse:
 	      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					     tim_p->tm_sec, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			    tim_p->tm_sec);
+	    len = conv_int (&s[count], maxsize - count, tim_p->tm_sec, 2, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('t'):
@@ -1180,9 +1222,14 @@ recurse:
 	    return 0;
 	  break;
 	case CQ('T'):
-          len = snprintf (&s[count], maxsize - count, CQ("%.2d:%.2d:%.2d"),
-			  tim_p->tm_hour, tim_p->tm_min, tim_p->tm_sec);
-          CHECK_LENGTH ();
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_hour, 2, 0);
+	  CHECK_LENGTH ();
+	  PUT_CHAR (CQ(':'));
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_min, 2, 0);
+	  CHECK_LENGTH ();
+	  PUT_CHAR (CQ(':'));
+	  len = conv_int (&s[count], maxsize - count, tim_p->tm_sec, 2, 0);
+	  CHECK_LENGTH ();
           break;
 	case CQ('u'):
 #ifdef _WANT_C99_TIME_FORMATS
@@ -1215,9 +1262,8 @@ recurse:
 					      tim_p->tm_wday) / 7,
 					     *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-			 (tim_p->tm_yday + 7 -
-			  tim_p->tm_wday) / 7);
+	    len = conv_int (&s[count], maxsize - count,
+			    (tim_p->tm_yday + 7 - tim_p->tm_wday) / 7, 2, 0);
           CHECK_LENGTH ();
 	  break;
 	case CQ('V'):
@@ -1241,7 +1287,7 @@ recurse:
 		|| !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					       week, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	      len = snprintf (&s[count], maxsize - count, CQ("%.2d"), week);
+	      len = conv_int (&s[count], maxsize - count, week, 2, 0);
             CHECK_LENGTH ();
 	  }
           break;
@@ -1270,7 +1316,7 @@ recurse:
 		|| !(len = conv_to_alt_digits (&s[count], maxsize - count,
 					       wday, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-	      len = snprintf (&s[count], maxsize - count, CQ("%.2d"), wday);
+	      len = conv_int (&s[count], maxsize - count, wday, 2, 0);
             CHECK_LENGTH ();
 	  }
 	  break;
@@ -1278,8 +1324,8 @@ recurse:
 	    {
 #ifdef _WANT_C99_TIME_FORMATS
 	      if (alt == 'E' && *era_info)
-		len = snprintf (&s[count], maxsize - count, CQ("%d"),
-				(*era_info)->year);
+		len = conv_int (&s[count], maxsize - count, (*era_info)->year,
+				1, 0);
 	      else
 #endif /* _WANT_C99_TIME_FORMATS */
 		{
@@ -1292,8 +1338,7 @@ recurse:
 		      || !(len = conv_to_alt_digits (&s[count], maxsize - count,
 						     year, *alt_digits)))
 #endif /* _WANT_C99_TIME_FORMATS */
-		    len = snprintf (&s[count], maxsize - count, CQ("%.2d"),
-				    year);
+		    len = conv_int (&s[count], maxsize - count, year, 2, 0);
 		}
               CHECK_LENGTH ();
 	    }
@@ -1308,29 +1353,23 @@ recurse:
 	  else
 #endif /* _WANT_C99_TIME_FORMATS */
 	    {
-	      CHAR fmtbuf[10], *fmt = fmtbuf;
 	      int sign = tim_p->tm_year < -YEAR_BASE;
 	      /* int potentially overflows, so use unsigned instead.  */
 	      register unsigned year = (unsigned) tim_p->tm_year
 				       + (unsigned) YEAR_BASE;
 	      if (sign)
 		{
-		  *fmt++ = CQ('-');
+		  PUT_CHAR (CQ('-'));
 		  year = UINT_MAX - year + 1;
 		}
 	      else if (pad == CQ('+') && year >= 10000)
 		{
-		  *fmt++ = CQ('+');
+		  PUT_CHAR (CQ('+'));
 		  sign = 1;
 		}
 	      if (width && sign)
 		--width;
-	      *fmt++ = CQ('%');
-	      if (pad)
-		*fmt++ = CQ('0');
-	      STRCPY (fmt, CQ(".*u"));
-	      len = snprintf (&s[count], maxsize - count, fmtbuf, width,
-			      year);
+	      len = conv_num (&s[count], maxsize - count, 0, year, width, 0);
 	      CHECK_LENGTH ();
 	    }
 	  break;
@@ -1364,10 +1403,13 @@ recurse:
 	      offset = -tz->__tzrule[tim_p->tm_isdst > 0].offset;
 #endif
 	      TZ_UNLOCK;
-	      len = snprintf (&s[count], maxsize - count, CQ("%+03ld%.2ld"),
-			      offset / SECSPERHOUR,
-			      labs (offset / SECSPERMIN) % 60L);
-              CHECK_LENGTH ();
+	      PUT_CHAR (offset / SECSPERHOUR < 0 ? CQ('-') : CQ('+'));
+	      len = conv_num (&s[count], maxsize - count, 0,
+			      labs (offset / SECSPERHOUR), 2, 0);
+	      CHECK_LENGTH ();
+	      len = conv_num (&s[count], maxsize - count, 0,
+			      labs (offset / SECSPERMIN) % 60L, 2, 0);
+	      CHECK_LENGTH ();
             }
           break;
 	case CQ('Z'):
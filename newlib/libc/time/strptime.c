@@ -31,6 +31,7 @@
  * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
 
 #define _GNU_SOURCE
+#include <sys/cdefs.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <time.h>
@@ -42,6 +43,7 @@
 #include <inttypes.h>
 #include <limits.h>
 #include "../locale/setlocale.h"
+#include "local.h"
 
 #define _ctloc(x) (_CurrentTimeLocale->x)
 
@@ -70,16 +72,24 @@ is_leap_year (int year)
     return (year % 4) == 0 && ((year % 100) != 0 || (year % 400) == 0);
 }
 
-/* Needed for strptime. */
+/*
+ * Needed for strptime.  Comparing the first character up front rejects
+ * almost every candidate name without calling strlen and strncasecmp_l.
+ */
 static int
-match_string (const char *__restrict *buf, const char * const*strs,
+match_string (const char *__restrict *buf, const char * const*strs, int n,
 	      locale_t locale)
 {
     int i = 0;
+    int c = tolower_l ((unsigned char) **buf, locale);
 
-    for (i = 0; strs[i] != NULL; ++i) {
-	int len = strlen (strs[i]);
+    for (i = 0; i < n; ++i) {
+	int len;
 
+	if (*strs[i] != '\0'
+	    && tolower_l ((unsigned char) *strs[i], locale) != c)
+	    continue;
+	len = strlen (strs[i]);
 	if (strncasecmp_l (*buf, strs[i], len, locale) == 0) {
 	    *buf += len;
 	    return i;
@@ -88,15 +98,32 @@ match_string (const char *__restrict *buf, const char * const*strs,
     return -1;
 }
 
+/*
+ * Needed for strptime.  Same as strtol_l (buf, endptr, 10, locale), but
+ * a plain string of up to 9 digits, which is what the numeric fields
+ * hold in practice, is converted inline.
+ */
+static long
+get_number (const char *buf, char **endptr, locale_t locale)
+{
+    const char *p = buf;
+    long ret = 0;
+
+    while (p - buf < 9 && *p >= '0' && *p <= '9')
+	ret = ret * 10 + (*p++ - '0');
+    if (p == buf || (*p >= '0' && *p <= '9'))
+	return strtol_l (buf, endptr, 10, locale);
+    *endptr = (char *) p;
+    return ret;
+}
+
 /* Needed for strptime. */
 static int
 first_day (int year)
 {
-    int ret = 4;
+    int ret = (EPOCH_WDAY + __days_from_civil (year, 0, 1)) % DAYSPERWEEK;
 
-    while (--year >= 1970)
-	ret = (ret + 365 + is_leap_year (year)) % 7;
-    return ret;
+    return ret < 0 ? ret + DAYSPERWEEK : ret;
 }
 
 /*
@@ -153,305 +180,339 @@ set_week_number_mon4 (struct tm *timeptr, int wnum)
     }
 }
 
-char *
-strptime_l (const char *buf, const char *format, struct tm *timeptr,
-	    locale_t locale)
+/*
+ * The name tables of the current locale, by conversion character.
+ */
+#define NAME_TABLES 5
+
+static int
+name_index (int c)
 {
-    char c;
-    int ymd = 0;
+    switch (c) {
+    case 'A' :
+	return 0;
+    case 'a' :
+	return 1;
+    case 'B' :
+	return 2;
+    case 'p' :
+	return 4;
+    default :			/* 'b', 'h' */
+	return 3;
+    }
+}
 
-    const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
-    for (; (c = *format) != '\0'; ++format) {
-	char *s;
-	int ret;
+static __always_inline const char * const *
+name_table (const struct lc_time_T *_CurrentTimeLocale, int c, int *n)
+{
+    switch (name_index (c)) {
+    case 0 :
+	*n = 7;
+	return _ctloc (weekday);
+    case 1 :
+	*n = 7;
+	return _ctloc (wday);
+    case 2 :
+	*n = 12;
+	return _ctloc (month);
+    case 4 :
+	*n = 2;
+	return _ctloc (am_pm);
+    default :
+	*n = 12;
+	return _ctloc (mon);
+    }
+}
 
-	if (isspace_l ((unsigned char) c, locale)) {
-	    while (isspace_l ((unsigned char) *buf, locale))
-		++buf;
-	} else if (c == '%' && format[1] != '\0') {
-	    c = *++format;
-	    if (c == 'E' || c == 'O')
-		c = *++format;
-	    switch (c) {
-	    case 'A' :
-		ret = match_string (&buf, _ctloc (weekday), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_wday = ret;
-		ymd |= SET_WDAY;
-		break;
-	    case 'a' :
-		ret = match_string (&buf, _ctloc (wday), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_wday = ret;
-		ymd |= SET_WDAY;
-		break;
-	    case 'B' :
-		ret = match_string (&buf, _ctloc (month), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_mon = ret;
-		ymd |= SET_MON;
-		break;
-	    case 'b' :
-	    case 'h' :
-		ret = match_string (&buf, _ctloc (mon), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_mon = ret;
-		ymd |= SET_MON;
-		break;
-	    case 'C' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_year = (ret * 100) - tm_year_base;
-		buf = s;
-		ymd |= SET_YEAR;
-		break;
-	    case 'c' :		/* %a %b %e %H:%M:%S %Y */
-		s = strptime_l (buf, _ctloc (c_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		ymd |= SET_WDAY | SET_YMD;
-		break;
-	    case 'D' :		/* %m/%d/%y */
-		s = strptime_l (buf, "%m/%d/%y", timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		ymd |= SET_YMD;
-		break;
-	    case 'd' :
-	    case 'e' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_mday = ret;
-		buf = s;
-		ymd |= SET_MDAY;
-		break;
-	    case 'F' :		/* %Y-%m-%d - GNU extension */
-		s = strptime_l (buf, "%Y-%m-%d", timeptr, locale);
-		if (s == NULL || s == buf)
-		    return NULL;
-		buf = s;
-		ymd |= SET_YMD;
-		break;
-	    case 'H' :
-	    case 'k' :		/* hour with leading space - GNU extension */
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_hour = ret;
-		buf = s;
-		break;
-	    case 'I' :
-	    case 'l' :		/* hour with leading space - GNU extension */
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		if (ret == 12)
-		    timeptr->tm_hour = 0;
-		else
-		    timeptr->tm_hour = ret;
-		buf = s;
-		break;
-	    case 'j' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_yday = ret - 1;
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'm' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_mon = ret - 1;
-		buf = s;
-		ymd |= SET_MON;
-		break;
-	    case 'M' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_min = ret;
-		buf = s;
-		break;
-	    case 'n' :
-		if (*buf == '\n')
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    case 'p' :
-		ret = match_string (&buf, _ctloc (am_pm), locale);
-		if (ret < 0)
-		    return NULL;
-		if (timeptr->tm_hour == 0) {
-		    if (ret == 1)
-			timeptr->tm_hour = 12;
-		} else
-		    timeptr->tm_hour += 12;
-		break;
-	    case 'r' :		/* %I:%M:%S %p */
-		s = strptime_l (buf, _ctloc (ampm_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		break;
-	    case 'R' :		/* %H:%M */
-		s = strptime_l (buf, "%H:%M", timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		break;
-	    case 's' :		/* seconds since Unix epoch - GNU extension */
-		{
-		    long long sec;
-		    time_t t;
-		    int save_errno;
-
-		    save_errno = errno;
-		    errno = 0;
-		    sec = strtoll_l (buf, &s, 10, locale);
-		    t = sec;
-		    if (s == buf
-			|| errno != 0
-			|| t != sec
-			|| localtime_r (&t, timeptr) != timeptr)
-			return NULL;
-		    errno = save_errno;
-		    buf = s;
-		    ymd |= SET_YDAY | SET_WDAY | SET_YMD;
-		    break;
-		}
-	    case 'S' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_sec = ret;
-		buf = s;
-		break;
-	    case 't' :
-		if (*buf == '\t')
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    case 'T' :		/* %H:%M:%S */
-		s = strptime_l (buf, "%H:%M:%S", timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		break;
-	    case 'u' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_wday = ret - 1;
-		buf = s;
-		ymd |= SET_WDAY;
-		break;
-	    case 'w' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_wday = ret;
-		buf = s;
-		ymd |= SET_WDAY;
-		break;
-	    case 'U' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		set_week_number_sun (timeptr, ret);
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'V' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		set_week_number_mon4 (timeptr, ret);
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'W' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		set_week_number_mon (timeptr, ret);
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'x' :
-		s = strptime_l (buf, _ctloc (x_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		ymd |= SET_YMD;
-		break;
-	    case 'X' :
-		s = strptime_l (buf, _ctloc (X_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-	    	break;
-	    case 'y' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		if (ret < 70)
-		    timeptr->tm_year = 100 + ret;
-		else
-		    timeptr->tm_year = ret;
-		buf = s;
-		ymd |= SET_YEAR;
-		break;
-	    case 'Y' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_year = ret - tm_year_base;
-		buf = s;
-		ymd |= SET_YEAR;
-		break;
-	    case 'Z' :
-		/* Unsupported. Just ignore.  */
-		break;
-	    case '\0' :
-		--format;
-		/* FALLTHROUGH */
-	    case '%' :
-		if (*buf == '%')
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    default :
-		if (*buf == '%' || *++buf == c)
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    }
-	} else {
-	    if (*buf == c)
-		++buf;
-	    else
+/*
+ * Store name number `ret' matched by conversion `c'.
+ */
+static __always_inline void
+set_name (struct tm *timeptr, int *ymd, int c, int ret)
+{
+    switch (c) {
+    case 'A' :
+    case 'a' :
+	timeptr->tm_wday = ret;
+	*ymd |= SET_WDAY;
+	break;
+    case 'p' :
+	/* %I has already turned 12 into 0.  */
+	if (ret == 1 && timeptr->tm_hour < 12)
+	    timeptr->tm_hour += 12;
+	break;
+    default :
+	timeptr->tm_mon = ret;
+	*ymd |= SET_MON;
+	break;
+    }
+}
+
+/*
+ * Parse one conversion `c' (with any E or O modifier dropped) at `buf'.
+ * Return the rest of `buf', or NULL if it does not match.
+ */
+static __always_inline const char *
+parse_field (const char *buf, int c, struct tm *timeptr, int *ymd,
+	     const struct lc_time_T *_CurrentTimeLocale, locale_t locale)
+{
+    const char * const *names;
+    char *s;
+    int ret, n;
+
+    switch (c) {
+    case 'A' :
+    case 'a' :
+    case 'B' :
+    case 'b' :
+    case 'h' :
+    case 'p' :
+	names = name_table (_CurrentTimeLocale, c, &n);
+	ret = match_string (&buf, names, n, locale);
+	if (ret < 0)
+	    return NULL;
+	set_name (timeptr, ymd, c, ret);
+	break;
+    case 'C' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_year = (ret * 100) - tm_year_base;
+	buf = s;
+	*ymd |= SET_YEAR;
+	break;
+    case 'c' :		/* %a %b %e %H:%M:%S %Y */
+	s = strptime_l (buf, _ctloc (c_fmt), timeptr, locale);
+	if (s == NULL)
+	    return NULL;
+	buf = s;
+	*ymd |= SET_WDAY | SET_YMD;
+	break;
+    case 'D' :		/* %m/%d/%y */
+	s = strptime_l (buf, "%m/%d/%y", timeptr, locale);
+	if (s == NULL)
+	    return NULL;
+	buf = s;
+	*ymd |= SET_YMD;
+	break;
+    case 'd' :
+    case 'e' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_mday = ret;
+	buf = s;
+	*ymd |= SET_MDAY;
+	break;
+    case 'F' :		/* %Y-%m-%d - GNU extension */
+	s = strptime_l (buf, "%Y-%m-%d", timeptr, locale);
+	if (s == NULL || s == buf)
+	    return NULL;
+	buf = s;
+	*ymd |= SET_YMD;
+	break;
+    case 'H' :
+    case 'k' :		/* hour with leading space - GNU extension */
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_hour = ret;
+	buf = s;
+	break;
+    case 'I' :
+    case 'l' :		/* hour with leading space - GNU extension */
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	if (ret == 12)
+	    timeptr->tm_hour = 0;
+	else
+	    timeptr->tm_hour = ret;
+	buf = s;
+	break;
+    case 'j' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_yday = ret - 1;
+	buf = s;
+	*ymd |= SET_YDAY;
+	break;
+    case 'm' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_mon = ret - 1;
+	buf = s;
+	*ymd |= SET_MON;
+	break;
+    case 'M' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_min = ret;
+	buf = s;
+	break;
+    case 'n' :
+	if (*buf == '\n')
+	    ++buf;
+	else
+	    return NULL;
+	break;
+    case 'r' :		/* %I:%M:%S %p */
+	s = strptime_l (buf, _ctloc (ampm_fmt), timeptr, locale);
+	if (s == NULL)
+	    return NULL;
+	buf = s;
+	break;
+    case 'R' :		/* %H:%M */
+	s = strptime_l (buf, "%H:%M", timeptr, locale);
+	if (s == NULL)
+	    return NULL;
+	buf = s;
+	break;
+    case 's' :		/* seconds since Unix epoch - GNU extension */
+	{
+	    long long sec;
+	    time_t t;
+	    int save_errno;
+
+	    save_errno = errno;
+	    errno = 0;
+	    sec = strtoll_l (buf, &s, 10, locale);
+	    t = sec;
+	    if (s == buf
+		|| errno != 0
+		|| t != sec
+		|| localtime_r (&t, timeptr) != timeptr)
 		return NULL;
+	    errno = save_errno;
+	    buf = s;
+	    *ymd |= SET_YDAY | SET_WDAY | SET_YMD;
+	    break;
 	}
+    case 'S' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_sec = ret;
+	buf = s;
+	break;
+    case 't' :
+	if (*buf == '\t')
+	    ++buf;
+	else
+	    return NULL;
+	break;
+    case 'T' :		/* %H:%M:%S */
+	s = strptime_l (buf, "%H:%M:%S", timeptr, locale);
+	if (s == NULL)
+	    return NULL;
+	buf = s;
+	break;
+    case 'u' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_wday = ret - 1;
+	buf = s;
+	*ymd |= SET_WDAY;
+	break;
+    case 'w' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_wday = ret;
+	buf = s;
+	*ymd |= SET_WDAY;
+	break;
+    case 'U' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	set_week_number_sun (timeptr, ret);
+	buf = s;
+	*ymd |= SET_YDAY;
+	break;
+    case 'V' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	set_week_number_mon4 (timeptr, ret);
+	buf = s;
+	*ymd |= SET_YDAY;
+	break;
+    case 'W' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	set_week_number_mon (timeptr, ret);
+	buf = s;
+	*ymd |= SET_YDAY;
+	break;
+    case 'x' :
+	s = strptime_l (buf, _ctloc (x_fmt), timeptr, locale);
+	if (s == NULL)
+	    return NULL;
+	buf = s;
+	*ymd |= SET_YMD;
+	break;
+    case 'X' :
+	s = strptime_l (buf, _ctloc (X_fmt), timeptr, locale);
+	if (s == NULL)
+	    return NULL;
+	buf = s;
+	break;
+    case 'y' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	if (ret < 70)
+	    timeptr->tm_year = 100 + ret;
+	else
+	    timeptr->tm_year = ret;
+	buf = s;
+	*ymd |= SET_YEAR;
+	break;
+    case 'Y' :
+	ret = get_number (buf, &s, locale);
+	if (s == buf)
+	    return NULL;
+	timeptr->tm_year = ret - tm_year_base;
+	buf = s;
+	*ymd |= SET_YEAR;
+	break;
+    case 'Z' :
+	/* Unsupported. Just ignore.  */
+	break;
+    case '%' :
+	if (*buf == '%')
+	    ++buf;
+	else
+	    return NULL;
+	break;
+    default :
+	if (*buf == '%' || *++buf == c)
+	    ++buf;
+	else
+	    return NULL;
+	break;
     }
+    return buf;
+}
 
+/*
+ * Fill in whichever of tm_yday, tm_mon, tm_mday and tm_wday follow from
+ * the fields set according to `ymd'.
+ */
+static __always_inline void
+finish_tm (struct tm *timeptr, int ymd)
+{
     if ((ymd & SET_YMD) == SET_YMD) {
 	/* all of tm_year, tm_mon and tm_mday, but... */
 
-	if (!(ymd & SET_YDAY)) {
+	if (!(ymd & SET_YDAY)
+	    && timeptr->tm_mon >= 0 && timeptr->tm_mon < 12) {
 	    /* ...not tm_yday, so fill it in */
 	    timeptr->tm_yday = _DAYS_BEFORE_MONTH[timeptr->tm_mon]
 		+ timeptr->tm_mday;
@@ -481,7 +542,8 @@ strptime_l (const char *buf, const char *format, struct tm *timeptr,
 	    }
 	}
 
-	if (!(ymd & SET_MDAY)) {
+	if (!(ymd & SET_MDAY)
+	    && timeptr->tm_mon >= 0 && timeptr->tm_mon < 12) {
 	    /* ...not tm_mday, so fill it in */
 	    timeptr->tm_mday = timeptr->tm_yday
 		- _DAYS_BEFORE_MONTH[timeptr->tm_mon];
@@ -498,7 +560,42 @@ strptime_l (const char *buf, const char *format, struct tm *timeptr,
 	int fday = first_day (timeptr->tm_year + tm_year_base);
 	timeptr->tm_wday = (fday + timeptr->tm_yday) % 7;
     }
+}
+
+char *
+strptime_l (const char *buf, const char *format, struct tm *timeptr,
+	    locale_t locale)
+{
+    char c;
+    int ymd = 0;
 
+    const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
+    for (; (c = *format) != '\0'; ++format) {
+	if (isspace_l ((unsigned char) c, locale)) {
+	    while (isspace_l ((unsigned char) *buf, locale))
+		++buf;
+	} else if (c == '%' && format[1] != '\0') {
+	    c = *++format;
+	    if (c == 'E' || c == 'O')
+		c = *++format;
+	    if (c == '\0') {
+		/* A trailing "%E" or "%O" matches a '%'.  */
+		--format;
+		c = '%';
+	    }
+	    buf = parse_field (buf, c, timeptr, &ymd, _CurrentTimeLocale,
+			       locale);
+	    if (buf == NULL)
+		return NULL;
+	} else {
+	    if (*buf == c)
+		++buf;
+	    else
+		return NULL;
+	}
+    }
+
+    finish_tm (timeptr, ymd);
     return (char *)buf;
 }
 
@@ -507,3 +604,308 @@ strptime (const char *buf, const char *format, struct tm *timeptr)
 {
   return strptime_l (buf, format, timeptr, __get_current_locale ());
 }
+
+/*
+ * Precompiled formats.  strptime_compile turns a format into a list of
+ * steps, with the locale's %c, %r, %x and %X formats and the fixed
+ * composite conversions compiled into nested lists, and builds a trie
+ * for each name table the format uses.  A nested list follows its
+ * OP_SUB step and ends with its own OP_END; it updates the struct tm
+ * the way the recursive strptime_l call in parse_field does.
+ */
+
+#define MAX_NESTING 4
+
+enum { OP_END, OP_SPACE, OP_CHAR, OP_FIELD, OP_NAME, OP_SUB };
+
+struct strptime_op {
+    unsigned char code;
+    char c;			/* literal or conversion character */
+    int arg;			/* OP_NAME: table, OP_SUB: length of list */
+};
+
+/*
+ * Each node holds one character, folded to lower case, of one or more
+ * names.  Node 0 is the root.
+ */
+struct name_node {
+    int ch;
+    int value;			/* first name ending here, or -1 */
+    int child;			/* first node one character on, or -1 */
+    int next;			/* next node with the same parent, or -1 */
+};
+
+struct name_trie {
+    struct name_node *nodes;
+    int n;
+};
+
+struct __strptime {
+    locale_t locale;
+    const struct lc_time_T *time_locale;
+    struct strptime_op *ops;
+    int nops;
+    int maxops;
+    struct name_trie names[NAME_TABLES];
+};
+
+static int
+build_trie (struct name_trie *t, const char * const *strs, int n,
+	    locale_t locale)
+{
+    size_t total = 1;
+    int i, k, node, ch;
+    const unsigned char *s;
+
+    for (i = 0; i < n; ++i)
+	total += strlen (strs[i]);
+    if (total > INT_MAX / sizeof (struct name_node)
+	|| (t->nodes = malloc (total * sizeof (struct name_node))) == NULL)
+	return -1;
+    t->nodes[0].ch = 0;
+    t->nodes[0].value = t->nodes[0].child = t->nodes[0].next = -1;
+    t->n = 1;
+
+    for (i = 0; i < n; ++i) {
+	node = 0;
+	for (s = (const unsigned char *) strs[i]; *s != '\0'; ++s) {
+	    ch = tolower_l (*s, locale);
+	    for (k = t->nodes[node].child; k >= 0; k = t->nodes[k].next)
+		if (t->nodes[k].ch == ch)
+		    break;
+	    if (k < 0) {
+		k = t->n++;
+		t->nodes[k].ch = ch;
+		t->nodes[k].value = t->nodes[k].child = -1;
+		t->nodes[k].next = t->nodes[node].child;
+		t->nodes[node].child = k;
+	    }
+	    node = k;
+	}
+	if (t->nodes[node].value < 0)
+	    t->nodes[node].value = i;
+    }
+    return 0;
+}
+
+/*
+ * Same as match_string: the lowest numbered name that is a prefix of
+ * `buf', ignoring case.
+ */
+static int
+match_trie (const char **buf, const struct name_trie *t, locale_t locale)
+{
+    const unsigned char *s = (const unsigned char *) *buf;
+    int node = 0, k, ch;
+    int best = t->nodes[0].value;
+    size_t len = 0;
+
+    while (*s != '\0') {
+	ch = tolower_l (*s++, locale);
+	for (k = t->nodes[node].child; k >= 0; k = t->nodes[k].next)
+	    if (t->nodes[k].ch == ch)
+		break;
+	if (k < 0)
+	    break;
+	node = k;
+	if (t->nodes[node].value >= 0
+	    && (best < 0 || t->nodes[node].value < best)) {
+	    best = t->nodes[node].value;
+	    len = (const char *) s - *buf;
+	}
+    }
+    if (best >= 0)
+	*buf += len;
+    return best;
+}
+
+static int
+add_op (struct __strptime *fmt, int code, int c, int arg)
+{
+    struct strptime_op *ops;
+
+    if (fmt->nops == fmt->maxops) {
+	int max = fmt->maxops ? 2 * fmt->maxops : 16;
+
+	ops = realloc (fmt->ops, max * sizeof (struct strptime_op));
+	if (ops == NULL)
+	    return -1;
+	fmt->ops = ops;
+	fmt->maxops = max;
+    }
+    fmt->ops[fmt->nops].code = code;
+    fmt->ops[fmt->nops].c = c;
+    fmt->ops[fmt->nops].arg = arg;
+    return fmt->nops++;
+}
+
+/*
+ * Append the steps for `format', and an OP_END if `end' is set.
+ */
+static int
+compile_list (struct __strptime *fmt, const char *format, int depth, int end)
+{
+    const struct lc_time_T *_CurrentTimeLocale = fmt->time_locale;
+    const char * const *names;
+    const char *sub;
+    char c;
+    int k, n;
+
+    if (depth > MAX_NESTING) {
+	errno = EINVAL;
+	return -1;
+    }
+    for (; (c = *format) != '\0'; ++format) {
+	if (isspace_l ((unsigned char) c, fmt->locale)) {
+	    if (add_op (fmt, OP_SPACE, 0, 0) < 0)
+		return -1;
+	    continue;
+	}
+	if (c != '%' || format[1] == '\0') {
+	    if (add_op (fmt, OP_CHAR, c, 0) < 0)
+		return -1;
+	    continue;
+	}
+	c = *++format;
+	if (c == 'E' || c == 'O')
+	    c = *++format;
+	if (c == '\0') {
+	    --format;
+	    c = '%';
+	}
+	switch (c) {
+	case 'A' :
+	case 'a' :
+	case 'B' :
+	case 'b' :
+	case 'h' :
+	case 'p' :
+	    k = name_index (c);
+	    if (fmt->names[k].nodes == NULL) {
+		names = name_table (_CurrentTimeLocale, c, &n);
+		if (build_trie (&fmt->names[k], names, n, fmt->locale) < 0)
+		    return -1;
+	    }
+	    if (add_op (fmt, OP_NAME, c, k) < 0)
+		return -1;
+	    continue;
+	case 'R' :
+	case 'T' :
+	    /* Time fields only, so nothing to fill in afterwards.  */
+	    if (compile_list (fmt, c == 'R' ? "%H:%M" : "%H:%M:%S",
+			      depth + 1, 0) < 0)
+		return -1;
+	    continue;
+	case 'c' :
+	    sub = _ctloc (c_fmt);
+	    break;
+	case 'D' :
+	    sub = "%m/%d/%y";
+	    break;
+	case 'F' :
+	    sub = "%Y-%m-%d";
+	    break;
+	case 'r' :
+	    sub = _ctloc (ampm_fmt);
+	    break;
+	case 'x' :
+	    sub = _ctloc (x_fmt);
+	    break;
+	case 'X' :
+	    sub = _ctloc (X_fmt);
+	    break;
+	default :
+	    if (add_op (fmt, OP_FIELD, c, 0) < 0)
+		return -1;
+	    continue;
+	}
+	if ((k = add_op (fmt, OP_SUB, c, 0)) < 0
+	    || compile_list (fmt, sub, depth + 1, 1) < 0)
+	    return -1;
+	fmt->ops[k].arg = fmt->nops - (k + 1);
+    }
+    if (end && add_op (fmt, OP_END, 0, 0) < 0)
+	return -1;
+    return 0;
+}
+
+static const char *
+exec_list (strptime_t fmt, int first, const char *buf, struct tm *timeptr)
+{
+    const struct strptime_op *op;
+    int ymd = 0, ret;
+
+    for (op = fmt->ops + first; op->code != OP_END; ++op) {
+	switch (op->code) {
+	case OP_SPACE :
+	    while (isspace_l ((unsigned char) *buf, fmt->locale))
+		++buf;
+	    break;
+	case OP_CHAR :
+	    if (*buf != op->c)
+		return NULL;
+	    ++buf;
+	    break;
+	case OP_NAME :
+	    ret = match_trie (&buf, &fmt->names[op->arg], fmt->locale);
+	    if (ret < 0)
+		return NULL;
+	    set_name (timeptr, &ymd, op->c, ret);
+	    break;
+	case OP_SUB :
+	    buf = exec_list (fmt, op - fmt->ops + 1, buf, timeptr);
+	    if (buf == NULL)
+		return NULL;
+	    if (op->c == 'c')
+		ymd |= SET_WDAY | SET_YMD;
+	    else if (op->c == 'D' || op->c == 'F' || op->c == 'x')
+		ymd |= SET_YMD;
+	    op += op->arg;
+	    break;
+	default :
+	    buf = parse_field (buf, op->c, timeptr, &ymd, fmt->time_locale,
+			       fmt->locale);
+	    if (buf == NULL)
+		return NULL;
+	    break;
+	}
+    }
+
+    finish_tm (timeptr, ymd);
+    return buf;
+}
+
+strptime_t
+strptime_compile (const char *format)
+{
+    strptime_t fmt = calloc (1, sizeof (struct __strptime));
+
+    if (fmt == NULL)
+	return NULL;
+    fmt->locale = __get_current_locale ();
+    fmt->time_locale = __get_time_locale (fmt->locale);
+    if (compile_list (fmt, format, 0, 1) < 0) {
+	strptime_free (fmt);
+	return NULL;
+    }
+    return fmt;
+}
+
+char *
+strptime_exec (strptime_t fmt, const char *buf, struct tm *timeptr)
+{
+    return (char *) exec_list (fmt, 0, buf, timeptr);
+}
+
+void
+strptime_free (strptime_t fmt)
+{
+    int i;
+
+    if (fmt == NULL)
+	return;
+    for (i = 0; i < NAME_TABLES; ++i)
+	free (fmt->names[i].nodes);
+    free (fmt->ops);
+    free (fmt);
+}
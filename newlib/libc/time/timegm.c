@@ -0,0 +1,53 @@
+/*
+FUNCTION
+<<timegm>>---convert UTC time to arithmetic representation
+
+INDEX
+	timegm
+
+SYNOPSIS
+	#include <time.h>
+	time_t timegm(struct tm *<[timp]>);
+
+DESCRIPTION
+<<timegm>> is like <<mktime>>, but assumes the time at <[timp]> is
+Coordinated Universal Time (UTC) rather than a local time.  The fields
+of <[timp]> are normalized, <<tm_wday>> and <<tm_yday>> are set and
+<<tm_isdst>> is set to zero.
+
+<<gmtime>> is the inverse of <<timegm>>.  As it does not depend on the
+time zone, <<timegm>> neither calls <<tzset>> nor takes the time zone
+lock.
+
+RETURNS
+If the contents of the structure at <[timp]> do not form a valid
+calendar time representation, the result is <<-1>>.  Otherwise, the
+result is the time, converted to a <<time_t>> value.
+
+PORTABILITY
+<<timegm>> is a BSD and GNU extension.
+
+<<timegm>> requires no supporting OS subroutines.
+*/
+
+#include <time.h>
+#include "local.h"
+
+time_t
+timegm (struct tm *tim_p)
+{
+  long days;
+
+  __normalize_tm (tim_p);
+
+  if (tim_p->tm_year > 10000 || tim_p->tm_year < -10000)
+      return (time_t) -1;
+
+  days = __days_from_civil (tim_p->tm_year + YEAR_BASE, tim_p->tm_mon,
+			    tim_p->tm_mday);
+
+  tim_p->tm_isdst = 0;
+
+  return (time_t) days * SECSPERDAY + tim_p->tm_hour * SECSPERHOUR +
+    tim_p->tm_min * SECSPERMIN + tim_p->tm_sec;
+}
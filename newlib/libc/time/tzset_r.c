@@ -5,6 +5,7 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/time.h>
+#include <sys/_tracepoint.h>
 #include "local.h"
 
 #define sscanf siscanf	/* avoid to pull in FP functions. */
@@ -22,7 +23,10 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   int i, ch;
   __tzinfo_type *tz = __gettzinfo ();
 
-  if ((tzenv = _getenv_r (reent_ptr, "TZ")) == NULL)
+  tzenv = _getenv_r (reent_ptr, "TZ");
+  __TRACEPOINT1 (tzset, tzenv);
+
+  if (tzenv == NULL)
       {
 	_timezone = 0;
 	_daylight = 0;
@@ -0,0 +1,30 @@
+/* Run-time detection of the instruction set extensions used by the
+   kernels in this directory.  The result is computed once; racing
+   first callers store the same value.  */
+
+#include <cpuid.h>
+#include "cpu_features.h"
+
+static int fma_usable = -1;
+
+int
+__x86_64_fma_usable (void)
+{
+  unsigned int eax, ebx, ecx, edx, xcr0, xcr0_hi;
+  int usable = 0;
+
+  if (fma_usable >= 0)
+    return fma_usable;
+
+  /* FMA3 instructions are VEX encoded, so besides the CPUID bit the
+     OS must have enabled the SSE and AVX state in XCR0.  */
+  if (__get_cpuid (1, &eax, &ebx, &ecx, &edx)
+      && (ecx & bit_FMA) && (ecx & bit_OSXSAVE))
+    {
+      asm ("xgetbv" : "=a" (xcr0), "=d" (xcr0_hi) : "c" (0));
+      usable = (xcr0 & 6) == 6;
+    }
+
+  fma_usable = usable;
+  return usable;
+}
@@ -0,0 +1,10 @@
+/* Run-time selection of the FMA builds of the libm kernels.  */
+
+#ifndef _X86_64_CPU_FEATURES_H_
+#define _X86_64_CPU_FEATURES_H_
+
+/* Nonzero if the processor implements FMA3 and the operating system
+   saves the AVX register state it needs.  */
+extern int __x86_64_fma_usable (void);
+
+#endif /* _X86_64_CPU_FEATURES_H_ */
@@ -0,0 +1,26 @@
+/* __ieee754_exp for x86_64.  Unless the library is already built for FMA3,
+   this contains the generic code and the first call selects either it or
+   the FMA3 build of the same code in e_exp_fma.c.  */
+
+#if defined (__FMA__)
+#include "../../math/e_exp.c"
+#else
+#include <stddef.h>
+#include "cpu_features.h"
+
+#define __ieee754_exp __ieee754_exp_sse2
+#include "../../math/e_exp.c"
+#undef __ieee754_exp
+
+extern double __ieee754_exp_fma (double);
+
+static double (*exp_impl) (double);
+
+double
+__ieee754_exp (double x)
+{
+  if (exp_impl == NULL)
+    exp_impl = __x86_64_fma_usable () ? __ieee754_exp_fma : __ieee754_exp_sse2;
+  return exp_impl (x);
+}
+#endif
@@ -0,0 +1,8 @@
+/* The generic __ieee754_exp built for FMA3, so that the compiler contracts
+   its polynomial evaluation.  e_exp.c selects it at run time.  */
+
+#if !defined (__FMA__)
+#pragma GCC target ("fma")
+#define __ieee754_exp __ieee754_exp_fma
+#include "../../math/e_exp.c"
+#endif
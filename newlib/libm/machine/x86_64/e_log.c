@@ -0,0 +1,26 @@
+/* __ieee754_log for x86_64.  Unless the library is already built for FMA3,
+   this contains the generic code and the first call selects either it or
+   the FMA3 build of the same code in e_log_fma.c.  */
+
+#if defined (__FMA__)
+#include "../../math/e_log.c"
+#else
+#include <stddef.h>
+#include "cpu_features.h"
+
+#define __ieee754_log __ieee754_log_sse2
+#include "../../math/e_log.c"
+#undef __ieee754_log
+
+extern double __ieee754_log_fma (double);
+
+static double (*log_impl) (double);
+
+double
+__ieee754_log (double x)
+{
+  if (log_impl == NULL)
+    log_impl = __x86_64_fma_usable () ? __ieee754_log_fma : __ieee754_log_sse2;
+  return log_impl (x);
+}
+#endif
@@ -0,0 +1,8 @@
+/* The generic __ieee754_log built for FMA3, so that the compiler contracts
+   its polynomial evaluation.  e_log.c selects it at run time.  */
+
+#if !defined (__FMA__)
+#pragma GCC target ("fma")
+#define __ieee754_log __ieee754_log_fma
+#include "../../math/e_log.c"
+#endif
@@ -0,0 +1,26 @@
+/* __ieee754_pow for x86_64.  Unless the library is already built for FMA3,
+   this contains the generic code and the first call selects either it or
+   the FMA3 build of the same code in e_pow_fma.c.  */
+
+#if defined (__FMA__)
+#include "../../math/e_pow.c"
+#else
+#include <stddef.h>
+#include "cpu_features.h"
+
+#define __ieee754_pow __ieee754_pow_sse2
+#include "../../math/e_pow.c"
+#undef __ieee754_pow
+
+extern double __ieee754_pow_fma (double, double);
+
+static double (*pow_impl) (double, double);
+
+double
+__ieee754_pow (double x, double y)
+{
+  if (pow_impl == NULL)
+    pow_impl = __x86_64_fma_usable () ? __ieee754_pow_fma : __ieee754_pow_sse2;
+  return pow_impl (x, y);
+}
+#endif
@@ -0,0 +1,8 @@
+/* The generic __ieee754_pow built for FMA3, so that the compiler contracts
+   its polynomial evaluation.  e_pow.c selects it at run time.  */
+
+#if !defined (__FMA__)
+#pragma GCC target ("fma")
+#define __ieee754_pow __ieee754_pow_fma
+#include "../../math/e_pow.c"
+#endif
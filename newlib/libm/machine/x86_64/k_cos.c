@@ -0,0 +1,26 @@
+/* __kernel_cos for x86_64.  Unless the library is already built for FMA3,
+   this contains the generic code and the first call selects either it or
+   the FMA3 build of the same code in k_cos_fma.c.  */
+
+#if defined (__FMA__)
+#include "../../math/k_cos.c"
+#else
+#include <stddef.h>
+#include "cpu_features.h"
+
+#define __kernel_cos __kernel_cos_sse2
+#include "../../math/k_cos.c"
+#undef __kernel_cos
+
+extern double __kernel_cos_fma (double, double);
+
+static double (*cos_impl) (double, double);
+
+double
+__kernel_cos (double x, double y)
+{
+  if (cos_impl == NULL)
+    cos_impl = __x86_64_fma_usable () ? __kernel_cos_fma : __kernel_cos_sse2;
+  return cos_impl (x, y);
+}
+#endif
@@ -0,0 +1,8 @@
+/* The generic __kernel_cos built for FMA3, so that the compiler contracts
+   its polynomial evaluation.  k_cos.c selects it at run time.  */
+
+#if !defined (__FMA__)
+#pragma GCC target ("fma")
+#define __kernel_cos __kernel_cos_fma
+#include "../../math/k_cos.c"
+#endif
@@ -0,0 +1,26 @@
+/* __kernel_sin for x86_64.  Unless the library is already built for FMA3,
+   this contains the generic code and the first call selects either it or
+   the FMA3 build of the same code in k_sin_fma.c.  */
+
+#if defined (__FMA__)
+#include "../../math/k_sin.c"
+#else
+#include <stddef.h>
+#include "cpu_features.h"
+
+#define __kernel_sin __kernel_sin_sse2
+#include "../../math/k_sin.c"
+#undef __kernel_sin
+
+extern double __kernel_sin_fma (double, double, int);
+
+static double (*sin_impl) (double, double, int);
+
+double
+__kernel_sin (double x, double y, int iy)
+{
+  if (sin_impl == NULL)
+    sin_impl = __x86_64_fma_usable () ? __kernel_sin_fma : __kernel_sin_sse2;
+  return sin_impl (x, y, iy);
+}
+#endif
@@ -0,0 +1,8 @@
+/* The generic __kernel_sin built for FMA3, so that the compiler contracts
+   its polynomial evaluation.  k_sin.c selects it at run time.  */
+
+#if !defined (__FMA__)
+#pragma GCC target ("fma")
+#define __kernel_sin __kernel_sin_fma
+#include "../../math/k_sin.c"
+#endif
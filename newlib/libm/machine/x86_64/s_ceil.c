@@ -0,0 +1,19 @@
+/* ceil for x86_64.  With SSE4.1 this is a single ROUNDSD, rounding toward
+   plus infinity, without raising inexact; otherwise the generic version is
+   built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+double
+ceil (double x)
+{
+  double result;
+  asm ("roundsd\t$10, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../math/s_ceil.c"
+#endif
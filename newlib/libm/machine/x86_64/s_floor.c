@@ -0,0 +1,19 @@
+/* floor for x86_64.  With SSE4.1 this is a single ROUNDSD, rounding toward
+   minus infinity, without raising inexact; otherwise the generic version
+   is built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+double
+floor (double x)
+{
+  double result;
+  asm ("roundsd\t$9, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../math/s_floor.c"
+#endif
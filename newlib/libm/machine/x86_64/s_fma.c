@@ -0,0 +1,17 @@
+/* fma for x86_64.  With FMA3 this is a single VFMADD231SD, which rounds
+   once as C99 requires; otherwise the generic version is built.  */
+
+#include <math.h>
+
+#if defined (__FMA__)
+
+double
+fma (double x, double y, double z)
+{
+  asm ("vfmadd231sd\t%2, %1, %0" : "+x" (z) : "x" (x), "x" (y));
+  return z;
+}
+
+#else
+#include "../../common/s_fma.c"
+#endif
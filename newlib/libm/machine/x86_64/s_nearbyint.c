@@ -0,0 +1,19 @@
+/* nearbyint for x86_64.  With SSE4.1 this is a single ROUNDSD, in the
+   current rounding mode, without raising inexact; otherwise the generic
+   version is built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+double
+nearbyint (double x)
+{
+  double result;
+  asm ("roundsd\t$12, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../common/s_nearbyint.c"
+#endif
@@ -0,0 +1,19 @@
+/* rint for x86_64.  With SSE4.1 this is a single ROUNDSD, in the current
+   rounding mode, raising inexact as needed; otherwise the generic version
+   is built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+double
+rint (double x)
+{
+  double result;
+  asm ("roundsd\t$4, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../common/s_rint.c"
+#endif
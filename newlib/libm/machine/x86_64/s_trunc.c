@@ -0,0 +1,18 @@
+/* trunc for x86_64.  With SSE4.1 this is a single ROUNDSD, rounding toward
+   zero, without raising inexact; otherwise the generic version is built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+double
+trunc (double x)
+{
+  double result;
+  asm ("roundsd\t$11, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../common/s_trunc.c"
+#endif
@@ -0,0 +1,19 @@
+/* ceilf for x86_64.  With SSE4.1 this is a single ROUNDSS, rounding toward
+   plus infinity, without raising inexact; otherwise the generic version is
+   built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+float
+ceilf (float x)
+{
+  float result;
+  asm ("roundss\t$10, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../math/sf_ceil.c"
+#endif
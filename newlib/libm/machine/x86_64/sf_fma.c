@@ -0,0 +1,17 @@
+/* fmaf for x86_64.  With FMA3 this is a single VFMADD231SS, which rounds
+   once as C99 requires; otherwise the generic version is built.  */
+
+#include <math.h>
+
+#if defined (__FMA__)
+
+float
+fmaf (float x, float y, float z)
+{
+  asm ("vfmadd231ss\t%2, %1, %0" : "+x" (z) : "x" (x), "x" (y));
+  return z;
+}
+
+#else
+#include "../../common/sf_fma.c"
+#endif
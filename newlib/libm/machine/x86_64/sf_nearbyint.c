@@ -0,0 +1,19 @@
+/* nearbyintf for x86_64.  With SSE4.1 this is a single ROUNDSS, in the
+   current rounding mode, without raising inexact; otherwise the generic
+   version is built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+float
+nearbyintf (float x)
+{
+  float result;
+  asm ("roundss\t$12, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../common/sf_nearbyint.c"
+#endif
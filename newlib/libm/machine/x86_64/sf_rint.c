@@ -0,0 +1,19 @@
+/* rintf for x86_64.  With SSE4.1 this is a single ROUNDSS, in the current
+   rounding mode, raising inexact as needed; otherwise the generic version
+   is built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+float
+rintf (float x)
+{
+  float result;
+  asm ("roundss\t$4, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../common/sf_rint.c"
+#endif
@@ -0,0 +1,19 @@
+/* truncf for x86_64.  With SSE4.1 this is a single ROUNDSS, rounding
+   toward zero, without raising inexact; otherwise the generic version is
+   built.  */
+
+#include <math.h>
+
+#if defined (__SSE4_1__)
+
+float
+truncf (float x)
+{
+  float result;
+  asm ("roundss\t$11, %1, %0" : "=x" (result) : "x" (x));
+  return result;
+}
+
+#else
+#include "../../common/sf_trunc.c"
+#endif
@@ -0,0 +1,84 @@
+#include "test.h"
+ three_line_type fma_vec[] = {
+{64, 0,123,__LINE__, 0x3e500000, 0x01000000, 0x3ff00000, 0x02000000, 0x3ff00000, 0x02000000, 0xbff00000, 0x00000000},	/* 1.49012e-08=f(1, 1, -1)*/
+{64, 0,123,__LINE__, 0xbc900000, 0x00000000, 0x3ff00000, 0x02000000, 0x3fefffff, 0xfc000000, 0xbff00000, 0x00000000},	/* -5.55112e-17=f(1, 1, -1)*/
+{64, 0,123,__LINE__, 0x39700000, 0x00000000, 0x3ff00000, 0x00000001, 0x3ff00000, 0x00000001, 0xbff00000, 0x00000002},	/* 4.93038e-32=f(1, 1, -1)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x04000000, 0x3ff00000, 0x02000000, 0x3ff00000, 0x02000000, 0x3af00000, 0x00000000},	/* 1=f(1, 1, 8.27181e-25)*/
+{64, 0,123,__LINE__, 0x3ff00000, 0x04000000, 0x3ff00000, 0x02000000, 0x3ff00000, 0x02000000, 0xbaf00000, 0x00000000},	/* 1=f(1, 1, -8.27181e-25)*/
+{64, 0,123,__LINE__, 0x3c900000, 0x00000000, 0x3fb99999, 0x9999999a, 0x40240000, 0x00000000, 0xbff00000, 0x00000000},	/* 5.55112e-17=f(0.1, 10, -1)*/
+{64, 0,123,__LINE__, 0xbc900000, 0x00000000, 0x3fd55555, 0x55555555, 0x40080000, 0x00000000, 0xbff00000, 0x00000000},	/* -5.55112e-17=f(0.333333, 3, -1)*/
+{64, 0,123,__LINE__, 0x7fefffff, 0xffffffff, 0x7fefffff, 0xffffffff, 0x40000000, 0x00000000, 0xffefffff, 0xffffffff},	/* 1.79769e+308=f(1.79769e+308, 2, -1.79769e+308)*/
+{64, 0,123,__LINE__, 0x7cafffff, 0xffffffff, 0x7fefffff, 0xffffffff, 0x3ff00000, 0x00000001, 0xffefffff, 0xffffffff},	/* 3.99168e+292=f(1.79769e+308, 1, -1.79769e+308)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000000, 0x1a700000, 0x00000000, 0x20b00000, 0x00000000, 0x00000000, 0x00000000},	/* 0=f(2.40992e-181, 3.05494e-151, 0)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000002, 0x1e600000, 0x00000000, 0x1e600000, 0x00000000, 0x00000000, 0x00000001},	/* 9.88131e-324=f(2.22276e-162, 2.22276e-162, 4.94066e-324)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000000, 0x1e480000, 0x00000000, 0x1e800000, 0x00000000, 0x80000000, 0x00000001},	/* 0=f(8.33535e-163, 8.89103e-162, -4.94066e-324)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40140000, 0x00000000, 0x80000000, 0x00000000},	/* 0=f(0, 5, -0)*/
+{64, 0,123,__LINE__, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x40140000, 0x00000000, 0x80000000, 0x00000000},	/* -0=f(-0, 5, -0)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000000, 0x3ff00000, 0x00000000, 0xbff00000, 0x00000000, 0x3ff00000, 0x00000000},	/* 0=f(1, -1, 1)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x40080000, 0x00000000, 0x40180000, 0x00000000},	/* 0=f(-2, 3, 6)*/
+{64, 0,123,__LINE__, 0x7ff00000, 0x00000000, 0x7ff00000, 0x00000000, 0x40000000, 0x00000000, 0x3ff00000, 0x00000000},	/* inf=f(inf, 2, 1)*/
+{64, 0,123,__LINE__, 0xfff00000, 0x00000000, 0x40000000, 0x00000000, 0x40080000, 0x00000000, 0xfff00000, 0x00000000},	/* -inf=f(2, 3, -inf)*/
+{64, 0,123,__LINE__, 0xfff00000, 0x00000000, 0x7fe1ccf3, 0x85ebc8a0, 0x40240000, 0x00000000, 0xfff00000, 0x00000000},	/* -inf=f(1e+308, 10, -inf)*/
+{64, 0,123,__LINE__, 0x40140000, 0x00000000, 0x419d6f34, 0x54000000, 0x41cd6f34, 0x58800000, 0xc37b1311, 0x4fbff538},	/* 5=f(1.23457e+08, 9.87654e+08, -1.21933e+17)*/
+{64, 0,123,__LINE__, 0xbb4f2394, 0xe6161498, 0xbef0ce71, 0xf035b466, 0xbecda576, 0x940fa7d2, 0xbdcf23fc, 0x086cfb3d},	/* -5.15151e-23=f(-1.60279e-05, -3.53412e-06, -5.66444e-11)*/
+{64, 0,123,__LINE__, 0x3fe47035, 0x712cdfe8, 0x3ed3c5dc, 0x04ce2940, 0xc0f089d8, 0x41d53ad4, 0x3feea850, 0x29c34fdc},	/* 0.638697=f(4.71422e-06, -67741.5, 0.958046)*/
+{64, 0,123,__LINE__, 0xbf77c846, 0x563a2bd1, 0xc0972bc1, 0x6b3f3748, 0x41a06334, 0xbeedb2a6, 0x4247bb6c, 0x8abb3def},	/* -0.00580623=f(-1482.94, 1.37469e+08, 2.03857e+11)*/
+{64, 0,123,__LINE__, 0x42420543, 0x1bde24a5, 0xc1880370, 0x206a5a34, 0x40980393, 0x8198724d, 0x424b07e4, 0xa9cd36f8},	/* 1.54795e+11=f(-5.03598e+07, 1536.89, 2.32193e+11)*/
+{64, 0,123,__LINE__, 0xc1a5baad, 0x48460361, 0xc1930c9f, 0xfc0d87c8, 0x4012403b, 0x777487c4, 0x41a5baad, 0x48460360},	/* -1.82278e+08=f(-7.98986e+07, 4.56273, 1.82278e+08)*/
+{64, 0,123,__LINE__, 0x411df8d6, 0xfbc4e76b, 0xc1c8a263, 0x0287bbe9, 0x41c377b6, 0x5ede6b93, 0x439df926, 0x1c9ad3d8},	/* 491062=f(-8.26591e+08, 6.53225e+08, 5.3995e+17)*/
+{64, 0,123,__LINE__, 0xc0342e2a, 0x6918c868, 0x40609743, 0x015a408c, 0x3fb3762d, 0x9a35515c, 0xc03e453f, 0x9da52c9c},	/* -20.1803=f(132.727, 0.076022, -30.2705)*/
+{64, 0,123,__LINE__, 0xbf422113, 0x7fa6a049, 0x4119462c, 0x64907e6b, 0x4096f3d1, 0xc4b97a6b, 0xc1c220d1, 0x13f15163},	/* -0.000553259=f(414091, 1468.95, -6.08281e+08)*/
+{64, 0,123,__LINE__, 0x3f9304b5, 0xdb28ec2a, 0x3fee093e, 0x5a3d05bf, 0xbf84430c, 0x493d2124, 0x3f9c8710, 0xc8bd623f},	/* 0.0185727=f(0.938628, -0.00989351, 0.027859)*/
+{64, 0,123,__LINE__, 0x3eeee4eb, 0x646b8812, 0xc097b922, 0x5b5fcd46, 0x40c4d65f, 0xcdea270e, 0x416ee545, 0x2a493510},	/* 1.47315e-05=f(-1518.28, 10668.7, 1.61982e+07)*/
+{64, 0,123,__LINE__, 0x40959c83, 0x98d38662, 0xbf23871c, 0x5de5b96a, 0xc171b50a, 0xaa311e1f, 0xc0959c83, 0x98d38661},	/* 1383.13=f(-0.000148985, -1.85673e+07, -1383.13)*/
+{64, 0,123,__LINE__, 0xbd26f9b8, 0x6eb489b8, 0x40707611, 0xeed9b706, 0xbf765e6d, 0xc71ec229, 0x3ff7037f, 0x42fce95d},	/* -4.08126e-14=f(263.379, -0.00546115, 1.43835)*/
+{64, 0,123,__LINE__, 0xbdf5f0cf, 0x414acd97, 0xc16702cc, 0xce905ffa, 0x3f4e8ff4, 0x493e96e3, 0x40c5fa24, 0x2ee77aa9},	/* -3.19279e-10=f(-1.20644e+07, 0.000932688, 11252.3)*/
+{64, 0,123,__LINE__, 0xc1b7e574, 0x7505d2f6, 0xc0e03ee5, 0xfd5582fc, 0xc0b788ef, 0x884e411c, 0xc1c1ec17, 0x57c45e39},	/* -4.00914e+08=f(-33271.2, -6024.94, -6.0137e+08)*/
+{64, 0,123,__LINE__, 0x40379e91, 0x7c93070c, 0x3fd38b12, 0x332b53eb, 0xc043564e, 0xe53f55f2, 0x4041b6ed, 0x1d6e4549},	/* 23.6194=f(0.305363, -38.6743, 35.4291)*/
+{64, 0,123,__LINE__, 0x3d236c86, 0x31b24a71, 0xbed007ad, 0x89987d1a, 0xbe536338, 0x816c59a2, 0xbd236c86, 0x31b24a70},	/* 3.45038e-14=f(-3.82185e-06, -1.80561e-08, -3.45038e-14)*/
+{64, 0,123,__LINE__, 0xc1a75eb1, 0xfa18a17f, 0xc1a4b96d, 0x3cd198ba, 0x40020ae0, 0xd00246fe, 0x41a75eb1, 0xfa18a180},	/* -1.96041e+08=f(-1.73848e+08, 2.25531, 1.96041e+08)*/
+{64, 0,123,__LINE__, 0xbdce3c50, 0x11f73260, 0xc11249ba, 0xe0e0fa78, 0xc0070892, 0x16b76f83, 0xc12a53c8, 0x7b742843},	/* -5.49982e-11=f(-299631, -2.87918, -862692)*/
+{64, 0,123,__LINE__, 0xbcd467d0, 0xd44bd06a, 0xbf33981c, 0xc8032b7b, 0x40609f27, 0x547ca9d4, 0x3fa45b04, 0x904433d3},	/* -1.13273e-15=f(-0.000298984, 132.974, 0.0397569)*/
+{64, 0,123,__LINE__, 0x3f901edb, 0x69143d92, 0x4007637f, 0xf580c106, 0xbf660e4c, 0x7de00704, 0x3f982e49, 0x1d9e5c5b},	/* 0.0157427=f(2.92358, -0.00269237, 0.0236141)*/
+{64, 0,123,__LINE__, 0xba314a47, 0x004d5230, 0xbe7f17ba, 0xc34c5c5f, 0x3f03e71b, 0xa4f1ede8, 0x3d9356a5, 0x0c7169e4},	/* -2.18232e-28=f(-1.15829e-07, 3.79615e-05, 4.39706e-12)*/
+{64, 0,123,__LINE__, 0xbce16ee9, 0xc5410bdf, 0x400987c5, 0xa8fde138, 0xbf95c019, 0xcbd9fb96, 0x3fb15a5c, 0xed9231e4},	/* -1.93548e-15=f(3.19129, -0.0212406, 0.0677851)*/
+{64, 0,123,__LINE__, 0x3f3726a0, 0x2bc9c7f4, 0x41d15741, 0xfe97eaab, 0x40254c78, 0x764e6dca, 0xc2071567, 0xa648316a},	/* 0.000353254=f(1.16372e+09, 10.6494, -1.23929e+10)*/
+{64, 0,123,__LINE__, 0xc18b0ee8, 0x74d343a4, 0x4111176e, 0x082fc8d8, 0xc0795488, 0x3b2ce3a9, 0x418b0ee8, 0x74d343a4},	/* -5.67452e+07=f(280028, -405.283, 5.67452e+07)*/
+{64, 0,123,__LINE__, 0x3d9b8188, 0xa418fbfd, 0x3e93cf9c, 0xa53b4510, 0x3f0636f9, 0x34b5f56a, 0xbd9b8188, 0xa418fbfd},	/* 6.25414e-12=f(2.95207e-07, 4.23713e-05, -6.25414e-12)*/
+{64, 0,123,__LINE__, 0x3c815ade, 0xe6a31b5c, 0x3fde689c, 0xf71e107e, 0xbf124334, 0x3736a152, 0x3f015ab4, 0xf21d2ac3},	/* 3.01061e-17=f(0.475135, -6.9666e-05, 3.31007e-05)*/
+{64, 0,123,__LINE__, 0x3f232156, 0xf3ab1e9a, 0x407ef81c, 0x01422542, 0x3ea3c459, 0x89c66c40, 0xbf232156, 0xf3ab1e99},	/* 0.000145952=f(495.507, 5.89102e-07, -0.000145952)*/
+{64, 0,123,__LINE__, 0xc05de24f, 0xaec00893, 0xc18749ea, 0xb29c77ff, 0xc14487c5, 0x5da30426, 0xc2dde204, 0x51eb5e7b},	/* -119.536=f(-4.884e+07, -2.69095e+06, -1.31426e+14)*/
+{64, 0,123,__LINE__, 0xbc947865, 0xcc42aeb4, 0x414bc341, 0x5ff00795, 0x3ea09d73, 0xd151d247, 0xbffcd476, 0x4807cbbb},	/* -7.10206e-17=f(3.63891e+06, 4.95167e-07, -1.80187)*/
+{64, 0,123,__LINE__, 0xbeedd365, 0x979fe9fa, 0xbfe579a5, 0xa4e3f2af, 0xbee638b8, 0xd24172b4, 0xbef65e8c, 0x31b7ef7b},	/* -1.4222e-05=f(-0.671099, -1.05961e-05, -2.13331e-05)*/
+{64, 0,123,__LINE__, 0xbf8ff588, 0x98e97ccc, 0xc038959c, 0x750295a1, 0xc1c4cceb, 0x83287352, 0xc20ff5e0, 0xfc084abf},	/* -0.015605=f(-24.5844, -6.97948e+08, -1.71586e+10)*/
+{64, 0,123,__LINE__, 0x3c508310, 0x498397a5, 0x3f97a8fe, 0x7ab6bc0b, 0x3f764df1, 0x689ed92c, 0xbf207dd0, 0x16cc22b2},	/* 3.58046e-18=f(0.0231056, 0.00544543, -0.00012582)*/
+{64, 0,123,__LINE__, 0x3fd420fe, 0x0cdabc02, 0x3f925cb7, 0xd81123cd, 0xc0218a17, 0x8bb8039b, 0x3fde317d, 0x13481a03},	/* 0.314514=f(0.0179318, -8.76971, 0.471771)*/
+{64, 0,123,__LINE__, 0xbd61ca5f, 0x0027b980, 0x40d2c0f5, 0x4d18ff76, 0xc02785d1, 0x0c77a7a9, 0x410b9239, 0x9d0605ba},	/* -5.05637e-13=f(19203.8, -11.7614, 225863)*/
+{64, 0,123,__LINE__, 0xc2e36370, 0xc7749488, 0x415060ca, 0xd1761383, 0xc192f0db, 0x8972448a, 0x42e36370, 0xc7749487},	/* -1.70543e+14=f(4.29342e+06, -7.94437e+07, 1.70543e+14)*/
+{64, 0,123,__LINE__, 0xbb84ba1a, 0x68fcb0f1, 0xc0315aa2, 0x94cb49b8, 0x3e131e7d, 0xff15238c, 0x3e54bcb3, 0xaa49fb2a},	/* -5.48638e-22=f(-17.354, 1.11288e-09, 1.93129e-08)*/
+{64, 0,123,__LINE__, 0x3ed99236, 0xd17d3c60, 0xc0f33513, 0xb86941aa, 0xc12ae35c, 0x7047deb8, 0xc2302398, 0x05b74aaa},	/* 6.09664e-06=f(-78673.2, -881070, -6.93166e+10)*/
+{64, 0,123,__LINE__, 0xc05824dc, 0xf109bed2, 0xc0617714, 0x62a11e1a, 0xbfd61e59, 0x725944ca, 0xc0621ba5, 0xb4c74f1e},	/* -96.576=f(-139.721, -0.345602, -144.864)*/
+{64, 0,123,__LINE__, 0xbd9ff882, 0xc668e02e, 0x3e11d43e, 0x2baa1f4c, 0xbf8cb0dd, 0xef2ca3e0, 0x3d9ff882, 0xc668e02e},	/* -7.26931e-12=f(1.03779e-09, -0.0140092, 7.26931e-12)*/
+{64, 0,123,__LINE__, 0x3be0d1b0, 0xfc8b465a, 0xbeb6ddeb, 0xb4e8bb81, 0xbfe7a764, 0xbd043230, 0xbeb0e71f, 0x8cb1b1e7},	/* 2.84927e-20=f(-1.36297e-06, -0.739184, -1.00749e-06)*/
+{64, 0,123,__LINE__, 0x3b01b4aa, 0xe1554552, 0x3ee45958, 0x6338638c, 0xbe8bd80e, 0xe4565163, 0x3d81b4c7, 0x209f875d},	/* 1.83073e-24=f(9.70316e-06, -2.07454e-07, 2.01296e-12)*/
+{64, 0,123,__LINE__, 0xbf90d021, 0xf7e93872, 0xc08f51ba, 0xda17bb9f, 0xbee12daf, 0x811300f3, 0xbf993832, 0xf3ddd4ab},	/* -0.016419=f(-1002.22, -8.19133e-06, -0.0246284)*/
+{64, 0,123,__LINE__, 0x3b7292ee, 0x03e83980, 0x3f40b26b, 0xc92a1b5e, 0xbf95be27, 0xaa1c0c18, 0x3ee6b09d, 0x9c67d05c},	/* 2.45824e-22=f(0.000509551, -0.0212332, 1.08194e-05)*/
+{64, 0,123,__LINE__, 0x3d6868b7, 0xf79c6b45, 0x3ef0ccb0, 0x097310fa, 0x41372d25, 0xc802acbf, 0xc03855a4, 0x6808788b},	/* 6.93747e-13=f(1.60213e-05, 1.51889e+06, -24.3345)*/
+{64, 0,123,__LINE__, 0xbcddc9c5, 0xff214024, 0x40c3d073, 0x5b8990e3, 0xbed80cfd, 0x2c6aa4a9, 0x3fadc8c2, 0xe6f46524},	/* -1.65358e-15=f(10144.9, -5.73414e-06, 0.0581723)*/
+{64, 0,123,__LINE__, 0x3df1212e, 0xe7567cf2, 0xbeed711d, 0x295beef2, 0x3ee29e34, 0x2bc718c7, 0x3df9b1c6, 0x5b01bb6b},	/* 2.49269e-10=f(-1.4039e-05, 8.87775e-06, 3.73903e-10)*/
+{64, 0,123,__LINE__, 0xbf1a37a7, 0x19dd24cb, 0xbe367b1b, 0x0c07baf0, 0xc0c2a8ca, 0x2c3799a6, 0xbf23a9bd, 0x5365db98},	/* -0.000100011=f(-5.23424e-09, -9553.58, -0.000150017)*/
+{64, 0,123,__LINE__, 0xbcf404d0, 0x690cdf86, 0x3f9bba4d, 0x3c5bf872, 0x3fc71af4, 0x8f2f3fe7, 0xbf740542, 0xcac19fb4},	/* -4.44507e-15=f(0.0270779, 0.18051, -0.00488783)*/
+{64, 0,123,__LINE__, 0xc167f8c0, 0x5d2f1353, 0xc03642b8, 0x6207b680, 0xc1113ad6, 0x9e4f7311, 0xc171fa90, 0x45e34e7e},	/* -1.25681e+07=f(-22.2606, -282294, -1.88521e+07)*/
+{64, 0,123,__LINE__, 0x3bfc7ba8, 0x721235bb, 0x3f05ab84, 0xeda7083e, 0x3fb51106, 0x70d52b0e, 0xbecc882d, 0x6e4aecae},	/* 9.65043e-20=f(4.13322e-05, 0.082291, -3.40127e-06)*/
+{64, 0,123,__LINE__, 0x3c2439e3, 0xff9c21c3, 0xbfa6b0f3, 0xa8c562cf, 0x3eec8665, 0xc61b768a, 0x3ea43a22, 0x5afaeeec},	/* 5.4823e-19=f(-0.0443188, 1.36018e-05, 6.02814e-07)*/
+{64, 0,123,__LINE__, 0x3f21788d, 0x587b8ace, 0x40c8c75e, 0xfcdf13dd, 0xc0c6911e, 0xd20e967d, 0x41a17970, 0x91d3fa20},	/* 0.000133292=f(12686.7, -11554.2, 1.46586e+08)*/
+{64, 0,123,__LINE__, 0xbe4ad713, 0xf4934ad2, 0xbff71796, 0x74acece3, 0x3e5298ce, 0xe63d126f, 0x3e4ad713, 0xf4934ad2},	/* -1.24984e-08=f(-1.44326, 1.73197e-08, 1.24984e-08)*/
+{64, 0,123,__LINE__, 0xbbed4cfa, 0xd2881020, 0xbff277c4, 0xeff0ba37, 0xbf53d78b, 0x407983e4, 0xbf56e703, 0xfe304a20},	/* -4.96373e-20=f(-1.15424, -0.00121106, -0.00139785)*/
+{64, 0,123,__LINE__, 0x3d3da473, 0x74e520bc, 0x3e650afe, 0x223d020f, 0xbeb689e0, 0xfc5c0df8, 0x3d463b56, 0x97abd88d},	/* 1.05311e-13=f(3.91955e-08, -1.3434e-06, 1.57966e-13)*/
+{64, 0,123,__LINE__, 0x3ef97b8d, 0x7c073fdf, 0xbfc68784, 0x167a4558, 0xbf3218ec, 0xed05eea1, 0xbef97b8d, 0x7c073fdf},	/* 2.43021e-05=f(-0.176011, -0.000276144, -2.43021e-05)*/
+{64, 0,123,__LINE__, 0xc0cac730, 0xdc197740, 0x41c55cfb, 0x00574f88, 0xc1c40115, 0x34053755, 0x439ab5ab, 0xdf9bbf2c},	/* -13710.4=f(7.1683e+08, -6.71231e+08, 4.81158e+17)*/
+{64, 0,123,__LINE__, 0x3c4f5c17, 0xf2309180, 0x4174ec7e, 0x26b53acf, 0x3e4b00a0, 0xf64fcb68, 0xbfd1a7f3, 0xb02de1ca},	/* 3.40003e-18=f(2.19402e+07, 1.2574e-08, -0.275876)*/
+{64, 0,123,__LINE__, 0xbb9ba331, 0x43767500, 0x4064c95e, 0xe7bdff84, 0x3ec12410, 0x4abee6eb, 0xbf3644cf, 0x163d8cf0},	/* -1.46312e-21=f(166.293, 2.04335e-06, -0.000339795)*/
+{64, 0,123,__LINE__, 0x3f8b3430, 0x89b15605, 0x407df732, 0xe2dfa29d, 0xbeed0cfd, 0xdc9dcf9c, 0x3f946724, 0x67450084},	/* 0.0132831=f(479.45, -1.38525e-05, 0.0199247)*/
+0,};
+test_fma(m)   {run_vector_3(m,fma_vec,(char *)(fma),"fma","dddd");   }	
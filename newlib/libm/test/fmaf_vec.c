@@ -0,0 +1,54 @@
+#include "test.h"
+ three_line_type fmaf_vec[] = {
+{64, 0,123,__LINE__, 0x3f400080, 0x00000000, 0x3ff00100, 0x00000000, 0x3ff00100, 0x00000000, 0xbff00000, 0x00000000},	/* 0.000488341=f(1.00024, 1.00024, -1)*/
+{64, 0,123,__LINE__, 0x3d100000, 0x00000000, 0x3ff00000, 0x20000000, 0x3ff00000, 0x20000000, 0xbff00000, 0x40000000},	/* 1.42109e-14=f(1, 1, -1)*/
+{64, 0,123,__LINE__, 0x3ff00200, 0x20000000, 0x3ff00100, 0x00000000, 0x3ff00100, 0x00000000, 0x3d700000, 0x00000000},	/* 1.00049=f(1.00024, 1.00024, 9.09495e-13)*/
+{64, 0,123,__LINE__, 0x3e500000, 0x00000000, 0x3fb99999, 0xa0000000, 0x40240000, 0x00000000, 0xbff00000, 0x00000000},	/* 1.49012e-08=f(0.1, 10, -1)*/
+{64, 0,123,__LINE__, 0x3e600000, 0x00000000, 0x3fd55555, 0x60000000, 0x40080000, 0x00000000, 0xbff00000, 0x00000000},	/* 2.98023e-08=f(0.333333, 3, -1)*/
+{64, 0,123,__LINE__, 0x47efffff, 0xe0000000, 0x47efffff, 0xe0000000, 0x40000000, 0x00000000, 0xc7efffff, 0xe0000000},	/* 3.40282e+38=f(3.40282e+38, 2, -3.40282e+38)*/
+{64, 0,123,__LINE__, 0x36b00000, 0x00000000, 0x3b400000, 0x00000000, 0x3b500000, 0x00000000, 0x36a00000, 0x00000000},	/* 2.8026e-45=f(2.64698e-23, 5.29396e-23, 1.4013e-45)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40140000, 0x00000000, 0x80000000, 0x00000000},	/* 0=f(0, 5, -0)*/
+{64, 0,123,__LINE__, 0x80000000, 0x00000000, 0x80000000, 0x00000000, 0x40140000, 0x00000000, 0x80000000, 0x00000000},	/* -0=f(-0, 5, -0)*/
+{64, 0,123,__LINE__, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x40080000, 0x00000000, 0x40180000, 0x00000000},	/* 0=f(-2, 3, 6)*/
+{64, 0,123,__LINE__, 0x3dda2059, 0x00000000, 0xbed0df37, 0x00000000, 0xbf08c6b2, 0x80000000, 0xbdda2059, 0x00000000},	/* 9.50471e-11=f(-4.02258e-06, -4.72568e-05, -9.50471e-11)*/
+{64, 0,123,__LINE__, 0xbee50001, 0x80000000, 0xbf8e5dfc, 0xa0000000, 0xc0361eec, 0x00000000, 0xbfd4fe1f, 0xc0000000},	/* -1.00136e-05=f(-0.0148277, -22.1208, -0.32801)*/
+{64, 0,123,__LINE__, 0xbf26e382, 0x20000000, 0xc00ed08b, 0x80000000, 0xbff7caeb, 0xc0000000, 0xc016e979, 0x80000000},	/* -0.000174627=f(-3.85183, -1.48704, -5.728)*/
+{64, 0,123,__LINE__, 0x3fd95dcf, 0x60000000, 0x41290487, 0xa0000000, 0xbf903943, 0xe0000000, 0x40c95e44, 0xa0000000},	/* 0.396351=f(819780, -0.0158434, 12988.5)*/
+{64, 0,123,__LINE__, 0xbf12f0ac, 0xc0000000, 0x4050da02, 0xe0000000, 0x3fa1f988, 0x80000000, 0xc002ee99, 0x80000000},	/* -7.22509e-05=f(67.4064, 0.0351069, -2.3665)*/
+{64, 0,123,__LINE__, 0x3e8b47ec, 0x40000000, 0x40b54908, 0xc0000000, 0x3f03c538, 0x40000000, 0xbfca4d16, 0xc0000000},	/* 2.03259e-07=f(5449.03, 3.7709e-05, -0.205478)*/
+{64, 0,123,__LINE__, 0xc072dc24, 0xc0000000, 0x41153149, 0x00000000, 0x403c75b4, 0x60000000, 0xc162d939, 0x40000000},	/* -301.759=f(347218, 28.4598, -9.88206e+06)*/
+{64, 0,123,__LINE__, 0xbfe3282b, 0x20000000, 0xc0f304ea, 0xc0000000, 0xbfd01930, 0x60000000, 0xc0d32302, 0x40000000},	/* -0.598653=f(-77902.7, -0.251537, -19596)*/
+{64, 0,123,__LINE__, 0x3fe52667, 0xa0000000, 0x3fa4097b, 0x60000000, 0xc020e384, 0x60000000, 0x3fefb99b, 0x80000000},	/* 0.660938=f(0.0391348, -8.44437, 0.991407)*/
+{64, 0,123,__LINE__, 0x3fd17cf0, 0x60000000, 0xc00f29b0, 0xa0000000, 0x40a1f67e, 0x20000000, 0x40c17e54, 0x20000000},	/* 0.273251=f(-3.89536, 2299.25, 8956.66)*/
+{64, 0,123,__LINE__, 0xbfaf59b5, 0x60000000, 0xc0f818c0, 0xe0000000, 0xbf94d1cd, 0x00000000, 0xc09f5b27, 0xe0000000},	/* -0.0612313=f(-98700.1, -0.0203316, -2006.79)*/
+{64, 0,123,__LINE__, 0x3eab0771, 0x80000000, 0x40474810, 0xa0000000, 0x3fdca891, 0xc0000000, 0xc034d9b2, 0xe0000000},	/* 8.05529e-07=f(46.563, 0.447789, -20.8504)*/
+{64, 0,123,__LINE__, 0x3db97020, 0x00000000, 0x3f825a7c, 0x80000000, 0x3fc954c9, 0x00000000, 0xbf5d0ea4, 0x20000000},	/* 2.31357e-11=f(0.00896165, 0.1979, -0.00177351)*/
+{64, 0,123,__LINE__, 0x3f722750, 0x00000000, 0xc0f3d1a8, 0x40000000, 0xc021a7aa, 0x80000000, 0xc125de72, 0x40000000},	/* 0.00443202=f(-81178.5, -8.82747, -716601)*/
+{64, 0,123,__LINE__, 0xbe32ed1f, 0xa0000000, 0xbf3f2f72, 0x40000000, 0xbed36bb1, 0xa0000000, 0xbe3c63af, 0x60000000},	/* -4.40661e-09=f(-0.00047585, -4.63025e-06, -6.60992e-09)*/
+{64, 0,123,__LINE__, 0x3eb54882, 0x20000000, 0x4023208b, 0xa0000000, 0xbf71c9f0, 0x60000000, 0x3fa54427, 0x20000000},	/* 1.26858e-06=f(9.56357, -0.00434297, 0.0415356)*/
+{64, 0,123,__LINE__, 0xbf8819fc, 0x80000000, 0xc125b47e, 0x00000000, 0x3f918cf1, 0xc0000000, 0x40c7cef7, 0xa0000000},	/* -0.0117683=f(-711231, 0.0171392, 12189.9)*/
+{64, 0,123,__LINE__, 0x3f56bf97, 0xc0000000, 0xc0a20774, 0x00000000, 0x3f942c95, 0xe0000000, 0x4046bbbb, 0xe0000000},	/* 0.00138845=f(-2307.73, 0.0197013, 45.4667)*/
+{64, 0,123,__LINE__, 0x3ef7ce23, 0x80000000, 0x4112880a, 0x00000000, 0x3f151f36, 0xc0000000, 0xc03876b2, 0xa0000000},	/* 2.27024e-05=f(303618, 8.05738e-05, -24.4637)*/
+{64, 0,123,__LINE__, 0xbe2bbfb2, 0xc0000000, 0x3f5ec2e5, 0x80000000, 0xbffc6d08, 0x40000000, 0x3f6b5356, 0xe0000000},	/* -3.23039e-09=f(0.00187752, -1.77662, 0.00333564)*/
+{64, 0,123,__LINE__, 0x3e9665b0, 0x60000000, 0x3ed4a486, 0x40000000, 0x40f0a3fd, 0x80000000, 0xbfd57818, 0x00000000},	/* 3.33745e-07=f(4.9216e-06, 68159.8, -0.335455)*/
+{64, 0,123,__LINE__, 0xbec8c9c3, 0xe0000000, 0x3eb386bd, 0xc0000000, 0x3ff44fc2, 0x80000000, 0xbed29752, 0xe0000000},	/* -2.95498e-06=f(1.16386e-06, 1.26947, -4.43247e-06)*/
+{64, 0,123,__LINE__, 0xbe6e36f4, 0x20000000, 0x3ea6a859, 0xe0000000, 0x40a558fe, 0xe0000000, 0xbf5e3b39, 0x40000000},	/* -5.62792e-08=f(6.7525e-07, 2732.5, -0.00184517)*/
+{64, 0,123,__LINE__, 0xbe1eb6a4, 0x00000000, 0x3f1cb1a9, 0x40000000, 0xc032052a, 0x60000000, 0x3f602890, 0x00000000},	/* -1.78776e-09=f(0.000109459, -18.0202, 0.00197247)*/
+{64, 0,123,__LINE__, 0x3f27cf0e, 0x40000000, 0x3ff44b1b, 0x20000000, 0xbf12c58d, 0x40000000, 0x3f31db4a, 0xc0000000},	/* 0.000181647=f(1.26834, -7.16083e-05, 0.00027247)*/
+{64, 0,123,__LINE__, 0xbeb080a1, 0xa0000000, 0x3eb60fda, 0x60000000, 0x40d7ee0b, 0x40000000, 0xbfa07fa3, 0xa0000000},	/* -9.83624e-07=f(1.31499e-06, 24504.2, -0.0322238)*/
+{64, 0,123,__LINE__, 0x3de02faa, 0xa0000000, 0xbf5467ff, 0x20000000, 0xbfb8ed55, 0x60000000, 0xbf1fcaae, 0x00000000},	/* 1.1777e-10=f(-0.0012455, -0.0973714, -0.000121276)*/
+{64, 0,123,__LINE__, 0x3f6b3610, 0x00000000, 0xc06e1199, 0x00000000, 0xc0a65ba1, 0x20000000, 0xc1250232, 0xa0000000},	/* 0.00332168=f(-240.55, -2861.81, -688409)*/
+{64, 0,123,__LINE__, 0x40098646, 0x80000000, 0xc12713f4, 0x60000000, 0xc011e3b7, 0xe0000000, 0xc149cda6, 0x60000000},	/* 3.19056=f(-756218, -4.47238, -3.38209e+06)*/
+{64, 0,123,__LINE__, 0x3f98f861, 0x40000000, 0x3ff4871a, 0xc0000000, 0x40d3ebd7, 0x60000000, 0xc0d98f02, 0xe0000000},	/* 0.024385=f(1.28298, 20399.4, -26172)*/
+{64, 0,123,__LINE__, 0x411d7369, 0x20000000, 0x40d35b8f, 0x40000000, 0x404857ac, 0x40000000, 0xc11d7369, 0x20000000},	/* 482522=f(19822.2, 48.6849, -482522)*/
+{64, 0,123,__LINE__, 0xbc844440, 0xa0000000, 0xbeb32bcb, 0x00000000, 0x3f0179ed, 0xe0000000, 0x3dc4f09e, 0xa0000000},	/* -3.5157e-17=f(-1.14268e-06, 3.33334e-05, 3.80895e-11)*/
+{64, 0,123,__LINE__, 0x3db0284f, 0x80000000, 0xbec28ec9, 0xe0000000, 0x4077f869, 0xe0000000, 0x3f4bcd62, 0x40000000},	/* 1.46951e-11=f(-2.21226e-06, 383.526, 0.000848458)*/
+{64, 0,123,__LINE__, 0x3f2edec3, 0xc0000000, 0x3fc5956c, 0xe0000000, 0xc046e644, 0x40000000, 0x401ee453, 0x80000000},	/* 0.000235521=f(0.168623, -45.799, 7.72297)*/
+{64, 0,123,__LINE__, 0xbef5f7d6, 0x60000000, 0xbf3e1cf2, 0x40000000, 0xbf97583c, 0x20000000, 0xbf0079e0, 0xc0000000},	/* -2.09504e-05=f(-0.000459489, -0.0227975, -3.14256e-05)*/
+{64, 0,123,__LINE__, 0xbffafcb6, 0x60000000, 0x4125237a, 0xc0000000, 0x3eb46d45, 0x00000000, 0xc0043d88, 0xc0000000},	/* -1.6867=f(692669, 1.21753e-06, -2.53005)*/
+{64, 0,123,__LINE__, 0xbcd43400, 0x00000000, 0xbf651187, 0xe0000000, 0x3f297660, 0x00000000, 0x3ea0c3a2, 0x00000000},	/* -1.1215e-15=f(-0.00257184, 0.000194263, 4.99612e-07)*/
+{64, 0,123,__LINE__, 0x3ed115aa, 0xa0000000, 0xbf68bc01, 0x20000000, 0x3f461a69, 0x00000000, 0x3ed9a080, 0x00000000},	/* 4.07329e-06=f(-0.00301933, 0.000674535, 6.10994e-06)*/
+{64, 0,123,__LINE__, 0xc00c4f7f, 0xe0000000, 0x40c2dae2, 0x20000000, 0xc077a2d0, 0xe0000000, 0x414bda81, 0xa0000000},	/* -3.53882=f(9653.77, -378.176, 3.65082e+06)*/
+{64, 0,123,__LINE__, 0xbf2c54fb, 0x60000000, 0xbf04852a, 0xe0000000, 0xc106180e, 0xa0000000, 0xc01c562e, 0x20000000},	/* -0.000216156=f(-3.91391e-05, -180994, -7.08416)*/
+0,};
+test_fmaf(m)   {run_vector_3(m,fmaf_vec,(char *)(fmaf),"fmaf","ffff");   }	
@@ -346,6 +346,140 @@ run_vector_1 (int vector,
   }
 }
 
+run_vector_3 (int vector,
+       three_line_type *p,
+       char *func,
+       char *name,
+       char *args)
+{
+  double result;
+  one_line_type l;
+
+  newfunc(name);
+  while (p->line) 
+  {
+    double arg1 = thedouble(p->qs[1].msw, p->qs[1].lsw);
+    double arg2 = thedouble(p->qs[2].msw, p->qs[2].lsw);
+    double arg3 = thedouble(p->qs[3].msw, p->qs[3].lsw);
+
+    line(p->line);          
+    merror = 0;
+    errno = 123;
+
+    if (strcmp(args,"dddd")==0)
+    {
+      typedef double (*pdblfunc) (double,double,double);
+
+      result = ((pdblfunc)(func))(arg1,arg2,arg3);
+    }
+    else
+    {
+      typedef float (*pdblfunc) (float,float,float);
+
+      result = ((pdblfunc)(func))(arg1,arg2,arg3);
+    }
+
+    /* finish only looks at the result, the line and the bits wanted.  */
+    l.error_bit = p->error_bit;
+    l.line = p->line;
+    l.qs[0] = p->qs[0];
+    finish(0, 0, result, &l, args, name);
+    p++;
+  }
+}
+
+#if defined (__x86_64__) && !defined (__FMA__)
+/* libm/machine/x86_64 builds these twice, plainly and for FMA3, and the
+   first call picks one.  Run both through the vectors of the functions
+   that use them, leaving out the lines that go through matherr.  */
+
+extern int __x86_64_fma_usable (void);
+extern int __ieee754_rem_pio2 (double, double *);
+
+#define KERNELS(s) \
+extern double __ieee754_exp##s (double); \
+extern double __ieee754_log##s (double); \
+extern double __ieee754_pow##s (double, double); \
+extern double __kernel_sin##s (double, double, int); \
+extern double __kernel_cos##s (double, double); \
+static double \
+sin##s (double x) \
+{ \
+  double y[2]; \
+  if (fabs(x) <= M_PI_4) \
+    return __kernel_sin##s(x, 0.0, 0); \
+  switch (__ieee754_rem_pio2(x, y) & 3) \
+  { \
+  case 0: return __kernel_sin##s(y[0], y[1], 1); \
+  case 1: return __kernel_cos##s(y[0], y[1]); \
+  case 2: return -__kernel_sin##s(y[0], y[1], 1); \
+  default: return -__kernel_cos##s(y[0], y[1]); \
+  } \
+} \
+static double \
+cos##s (double x) \
+{ \
+  double y[2]; \
+  if (fabs(x) <= M_PI_4) \
+    return __kernel_cos##s(x, 0.0); \
+  switch (__ieee754_rem_pio2(x, y) & 3) \
+  { \
+  case 0: return __kernel_cos##s(y[0], y[1]); \
+  case 1: return -__kernel_sin##s(y[0], y[1], 1); \
+  case 2: return -__kernel_cos##s(y[0], y[1]); \
+  default: return __kernel_sin##s(y[0], y[1], 1); \
+  } \
+}
+
+KERNELS(_sse2)
+KERNELS(_fma)
+
+extern one_line_type exp_vec[], log_vec[], pow_vec[], sin_vec[], cos_vec[];
+
+static void
+run_kernel (one_line_type *p,
+       char *func,
+       char *name,
+       char *args)
+{
+  double result;
+
+  newfunc(name);
+  for (; p->line; p++) 
+  {
+    double arg1 = thedouble(p->qs[1].msw, p->qs[1].lsw);
+    double arg2 = thedouble(p->qs[2].msw, p->qs[2].lsw);
+
+    /* frontline writes the matherr code into the second field.  */
+    if (p->errno_val != 0)
+      continue;
+    line(p->line);
+    if (strcmp(args,"dd")==0)
+      result = ((double (*) (double))(func))(arg1);
+    else
+      result = ((double (*) (double,double))(func))(arg1,arg2);
+    finish(0, 0, result, p, args, name);
+  }
+}
+
+static void
+test_kernels (void)
+{
+  run_kernel(exp_vec, (char *)__ieee754_exp_sse2, "exp_sse2", "dd");
+  run_kernel(log_vec, (char *)__ieee754_log_sse2, "log_sse2", "dd");
+  run_kernel(pow_vec, (char *)__ieee754_pow_sse2, "pow_sse2", "ddd");
+  run_kernel(sin_vec, (char *)sin_sse2, "sin_sse2", "dd");
+  run_kernel(cos_vec, (char *)cos_sse2, "cos_sse2", "dd");
+  if (!__x86_64_fma_usable())
+    return;
+  run_kernel(exp_vec, (char *)__ieee754_exp_fma, "exp_fma", "dd");
+  run_kernel(log_vec, (char *)__ieee754_log_fma, "log_fma", "dd");
+  run_kernel(pow_vec, (char *)__ieee754_pow_fma, "pow_fma", "ddd");
+  run_kernel(sin_vec, (char *)sin_fma, "sin_fma", "dd");
+  run_kernel(cos_vec, (char *)cos_fma, "cos_fma", "dd");
+}
+#endif
+
 void
 test_math (void)
 {
@@ -379,6 +513,12 @@ test_math (void)
   test_fabsf(0);
   test_floor(0);
   test_floorf(0);
+#ifdef __FMA__
+  /* The generic fma is x * y + z, which rounds twice, so only a fused
+     fma gets all of these right.  */
+  test_fma(0);
+  test_fmaf(0);
+#endif
   test_fmod(0);
   test_fmodf(0);
   test_gamma(0);
@@ -399,6 +539,9 @@ test_math (void)
   test_log2(0);
   test_log2f(0);
   test_logf(0);
+  test_pow_vec(0);
+  test_rint(0);
+  test_rintf(0);
   test_sin(0);
   test_sinf(0);
   test_sinh(0);
@@ -409,12 +552,17 @@ test_math (void)
   test_tanf(0);
   test_tanh(0);
   test_tanhf(0);
+  test_trunc(0);
+  test_truncf(0);
   test_y0(0);
   test_y0f(0);
   test_y1(0);
   test_y1f(0);
   test_y1f(0);
   test_ynf(0);
+#if defined (__x86_64__) && !defined (__FMA__)
+  test_kernels();
+#endif
 }
 
 /* These have to be played with to get to compile on machines which
@@ -0,0 +1,256 @@
+#include "test.h"
+ one_line_type pow_vec[] = {
+{62, 0,123,__LINE__, 0x41134d0f, 0x1066b7cb, 0x3fb99999, 0x9999999a, 0xc0160000, 0x00000000},	/* 316228=f(0.1, -5.5)*/
+{62, 0,123,__LINE__, 0x408f3fff, 0xffffffff, 0x3fb99999, 0x9999999a, 0xc0080000, 0x00000000},	/* 1000=f(0.1, -3)*/
+{62, 0,123,__LINE__, 0x40240000, 0x00000000, 0x3fb99999, 0x9999999a, 0xbff00000, 0x00000000},	/* 10=f(0.1, -1)*/
+{62, 0,123,__LINE__, 0x40094c58, 0x3ada5b52, 0x3fb99999, 0x9999999a, 0xbfe00000, 0x00000000},	/* 3.16228=f(0.1, -0.5)*/
+{62, 0,123,__LINE__, 0x3fe1feb3, 0x3c1c381e, 0x3fb99999, 0x9999999a, 0x3fd00000, 0x00000000},	/* 0.562341=f(0.1, 0.25)*/
+{62, 0,123,__LINE__, 0x3fd43d13, 0x6248490f, 0x3fb99999, 0x9999999a, 0x3fe00000, 0x00000000},	/* 0.316228=f(0.1, 0.5)*/
+{62, 0,123,__LINE__, 0x3fddb4c7, 0x760bcff3, 0x3fb99999, 0x9999999a, 0x3fd55555, 0x55555555},	/* 0.464159=f(0.1, 0.333333)*/
+{62, 0,123,__LINE__, 0x3fa030dc, 0x4ea03a73, 0x3fb99999, 0x9999999a, 0x3ff80000, 0x00000000},	/* 0.0316228=f(0.1, 1.5)*/
+{62, 0,123,__LINE__, 0x3f847ae1, 0x47ae147c, 0x3fb99999, 0x9999999a, 0x40000000, 0x00000000},	/* 0.01=f(0.1, 2)*/
+{62, 0,123,__LINE__, 0x3f2a26fd, 0x472780c3, 0x3fb99999, 0x9999999a, 0x400d9999, 0x9999999a},	/* 0.000199526=f(0.1, 3.7)*/
+{62, 0,123,__LINE__, 0x3ddb7cdf, 0xd9d7bdbf, 0x3fb99999, 0x9999999a, 0x40240000, 0x00000000},	/* 1e-10=f(0.1, 10)*/
+{62, 0,123,__LINE__, 0x398039d6, 0x65896887, 0x3fb99999, 0x9999999a, 0x403f0000, 0x00000000},	/* 1e-31=f(0.1, 31)*/
+{62, 0,123,__LINE__, 0x4046a09e, 0x667f3bcd, 0x3fe00000, 0x00000000, 0xc0160000, 0x00000000},	/* 45.2548=f(0.5, -5.5)*/
+{62, 0,123,__LINE__, 0x40200000, 0x00000000, 0x3fe00000, 0x00000000, 0xc0080000, 0x00000000},	/* 8=f(0.5, -3)*/
+{62, 0,123,__LINE__, 0x40000000, 0x00000000, 0x3fe00000, 0x00000000, 0xbff00000, 0x00000000},	/* 2=f(0.5, -1)*/
+{62, 0,123,__LINE__, 0x3ff6a09e, 0x667f3bcd, 0x3fe00000, 0x00000000, 0xbfe00000, 0x00000000},	/* 1.41421=f(0.5, -0.5)*/
+{62, 0,123,__LINE__, 0x3feae89f, 0x995ad3ad, 0x3fe00000, 0x00000000, 0x3fd00000, 0x00000000},	/* 0.840896=f(0.5, 0.25)*/
+{62, 0,123,__LINE__, 0x3fe6a09e, 0x667f3bcd, 0x3fe00000, 0x00000000, 0x3fe00000, 0x00000000},	/* 0.707107=f(0.5, 0.5)*/
+{62, 0,123,__LINE__, 0x3fe965fe, 0xa53d6e3d, 0x3fe00000, 0x00000000, 0x3fd55555, 0x55555555},	/* 0.793701=f(0.5, 0.333333)*/
+{62, 0,123,__LINE__, 0x3fd6a09e, 0x667f3bcd, 0x3fe00000, 0x00000000, 0x3ff80000, 0x00000000},	/* 0.353553=f(0.5, 1.5)*/
+{62, 0,123,__LINE__, 0x3fd00000, 0x00000000, 0x3fe00000, 0x00000000, 0x40000000, 0x00000000},	/* 0.25=f(0.5, 2)*/
+{62, 0,123,__LINE__, 0x3fb3b2c4, 0x7bff8328, 0x3fe00000, 0x00000000, 0x400d9999, 0x9999999a},	/* 0.0769465=f(0.5, 3.7)*/
+{62, 0,123,__LINE__, 0x3f500000, 0x00000000, 0x3fe00000, 0x00000000, 0x40240000, 0x00000000},	/* 0.000976562=f(0.5, 10)*/
+{62, 0,123,__LINE__, 0x3e000000, 0x00000000, 0x3fe00000, 0x00000000, 0x403f0000, 0x00000000},	/* 4.65661e-10=f(0.5, 31)*/
+{62, 0,123,__LINE__, 0x3ffc8fd4, 0xbdb10bb5, 0x3feccccc, 0xcccccccd, 0xc0160000, 0x00000000},	/* 1.78511=f(0.9, -5.5)*/
+{62, 0,123,__LINE__, 0x3ff5f2a7, 0xdb7a8e92, 0x3feccccc, 0xcccccccd, 0xc0080000, 0x00000000},	/* 1.37174=f(0.9, -3)*/
+{62, 0,123,__LINE__, 0x3ff1c71c, 0x71c71c72, 0x3feccccc, 0xcccccccd, 0xbff00000, 0x00000000},	/* 1.11111=f(0.9, -1)*/
+{62, 0,123,__LINE__, 0x3ff0dd90, 0x273c3ce2, 0x3feccccc, 0xcccccccd, 0xbfe00000, 0x00000000},	/* 1.05409=f(0.9, -0.5)*/
+{62, 0,123,__LINE__, 0x3fef2b09, 0xe7a28003, 0x3feccccc, 0xcccccccd, 0x3fd00000, 0x00000000},	/* 0.974004=f(0.9, 0.25)*/
+{62, 0,123,__LINE__, 0x3fee5b9d, 0x136c6d96, 0x3feccccc, 0xcccccccd, 0x3fe00000, 0x00000000},	/* 0.948683=f(0.9, 0.5)*/
+{62, 0,123,__LINE__, 0x3feee549, 0xfe7085e7, 0x3feccccc, 0xcccccccd, 0x3fd55555, 0x55555555},	/* 0.965489=f(0.9, 0.333333)*/
+{62, 0,123,__LINE__, 0x3feb5273, 0xc4ae62a1, 0x3feccccc, 0xcccccccd, 0x3ff80000, 0x00000000},	/* 0.853815=f(0.9, 1.5)*/
+{62, 0,123,__LINE__, 0x3fe9eb85, 0x1eb851ec, 0x3feccccc, 0xcccccccd, 0x40000000, 0x00000000},	/* 0.81=f(0.9, 2)*/
+{62, 0,123,__LINE__, 0x3fe5ab5f, 0x07dccede, 0x3feccccc, 0xcccccccd, 0x400d9999, 0x9999999a},	/* 0.677169=f(0.9, 3.7)*/
+{62, 0,123,__LINE__, 0x3fd650bf, 0x60432fd9, 0x3feccccc, 0xcccccccd, 0x40240000, 0x00000000},	/* 0.348678=f(0.9, 10)*/
+{62, 0,123,__LINE__, 0x3fa388aa, 0x1d2d499a, 0x3feccccc, 0xcccccccd, 0x403f0000, 0x00000000},	/* 0.038152=f(0.9, 31)*/
+{62, 0,123,__LINE__, 0x3ff0e8c9, 0xe2015bab, 0x3fefae14, 0x7ae147ae, 0xc0160000, 0x00000000},	/* 1.05683=f(0.99, -5.5)*/
+{62, 0,123,__LINE__, 0x3ff07d61, 0x12251211, 0x3fefae14, 0x7ae147ae, 0xc0080000, 0x00000000},	/* 1.03061=f(0.99, -3)*/
+{62, 0,123,__LINE__, 0x3ff0295f, 0xad40a57f, 0x3fefae14, 0x7ae147ae, 0xbff00000, 0x00000000},	/* 1.0101=f(0.99, -1)*/
+{62, 0,123,__LINE__, 0x3ff014a2, 0x883c8175, 0x3fefae14, 0x7ae147ae, 0xbfe00000, 0x00000000},	/* 1.00504=f(0.99, -0.5)*/
+{62, 0,123,__LINE__, 0x3fefeb71, 0x57fddfbc, 0x3fefae14, 0x7ae147ae, 0x3fd00000, 0x00000000},	/* 0.997491=f(0.99, 0.25)*/
+{62, 0,123,__LINE__, 0x3fefd6ef, 0xe4c9b8a5, 0x3fefae14, 0x7ae147ae, 0x3fe00000, 0x00000000},	/* 0.994987=f(0.99, 0.5)*/
+{62, 0,123,__LINE__, 0x3fefe49a, 0x0fb2bf3e, 0x3fefae14, 0x7ae147ae, 0x3fd55555, 0x55555555},	/* 0.996655=f(0.99, 0.333333)*/
+{62, 0,123,__LINE__, 0x3fef856d, 0x7ea8fbeb, 0x3fefae14, 0x7ae147ae, 0x3ff80000, 0x00000000},	/* 0.985038=f(0.99, 1.5)*/
+{62, 0,123,__LINE__, 0x3fef5cfa, 0xacd9e83e, 0x3fefae14, 0x7ae147ae, 0x40000000, 0x00000000},	/* 0.9801=f(0.99, 2)*/
+{62, 0,123,__LINE__, 0x3feed4f6, 0xfa530893, 0x3fefae14, 0x7ae147ae, 0x400d9999, 0x9999999a},	/* 0.963497=f(0.99, 3.7)*/
+{62, 0,123,__LINE__, 0x3fecf0b2, 0xad680bbf, 0x3fefae14, 0x7ae147ae, 0x40240000, 0x00000000},	/* 0.904382=f(0.99, 10)*/
+{62, 0,123,__LINE__, 0x3fe76f07, 0x79ed51ce, 0x3fefae14, 0x7ae147ae, 0x403f0000, 0x00000000},	/* 0.732303=f(0.99, 31)*/
+{62, 0,123,__LINE__, 0x3fee4bb9, 0x897965b5, 0x3ff028f5, 0xc28f5c29, 0xc0160000, 0x00000000},	/* 0.946744=f(1.01, -5.5)*/
+{62, 0,123,__LINE__, 0x3fef0f13, 0x11e568bc, 0x3ff028f5, 0xc28f5c29, 0xc0080000, 0x00000000},	/* 0.97059=f(1.01, -3)*/
+{62, 0,123,__LINE__, 0x3fefaee4, 0x1e6a7498, 0x3ff028f5, 0xc28f5c29, 0xbff00000, 0x00000000},	/* 0.990099=f(1.01, -1)*/
+{62, 0,123,__LINE__, 0x3fefd758, 0x3bc82e29, 0x3ff028f5, 0xc28f5c29, 0xbfe00000, 0x00000000},	/* 0.995037=f(1.01, -0.5)*/
+{62, 0,123,__LINE__, 0x3ff00a33, 0xaaa33284, 0x3ff028f5, 0xc28f5c29, 0x3fd00000, 0x00000000},	/* 1.00249=f(1.01, 0.25)*/
+{62, 0,123,__LINE__, 0x3ff0146d, 0xd68287f3, 0x3ff028f5, 0xc28f5c29, 0x3fe00000, 0x00000000},	/* 1.00499=f(1.01, 0.5)*/
+{62, 0,123,__LINE__, 0x3ff00d9b, 0xaab294bc, 0x3ff028f5, 0xc28f5c29, 0x3fd55555, 0x55555555},	/* 1.00332=f(1.01, 0.333333)*/
+{62, 0,123,__LINE__, 0x3ff03d97, 0xe57479f3, 0x3ff028f5, 0xc28f5c29, 0x3ff80000, 0x00000000},	/* 1.01504=f(1.01, 1.5)*/
+{62, 0,123,__LINE__, 0x3ff05254, 0x60aa64c3, 0x3ff028f5, 0xc28f5c29, 0x40000000, 0x00000000},	/* 1.0201=f(1.01, 2)*/
+{62, 0,123,__LINE__, 0x3ff0999c, 0x0c8487b3, 0x3ff028f5, 0xc28f5c29, 0x400d9999, 0x9999999a},	/* 1.0375=f(1.01, 3.7)*/
+{62, 0,123,__LINE__, 0x3ff1ac88, 0x3ff14422, 0x3ff028f5, 0xc28f5c29, 0x40240000, 0x00000000},	/* 1.10462=f(1.01, 10)*/
+{62, 0,123,__LINE__, 0x3ff5c7ff, 0x3e96abcd, 0x3ff028f5, 0xc28f5c29, 0x403f0000, 0x00000000},	/* 1.36133=f(1.01, 31)*/
+{62, 0,123,__LINE__, 0x3fe2f1de, 0xf12f18ef, 0x3ff19999, 0x9999999a, 0xc0160000, 0x00000000},	/* 0.592025=f(1.1, -5.5)*/
+{62, 0,123,__LINE__, 0x3fe80ac5, 0x565befd6, 0x3ff19999, 0x9999999a, 0xc0080000, 0x00000000},	/* 0.751315=f(1.1, -3)*/
+{62, 0,123,__LINE__, 0x3fed1745, 0xd1745d17, 0x3ff19999, 0x9999999a, 0xbff00000, 0x00000000},	/* 0.909091=f(1.1, -1)*/
+{62, 0,123,__LINE__, 0x3fee82c3, 0xf9d89e1b, 0x3ff19999, 0x9999999a, 0xbfe00000, 0x00000000},	/* 0.953463=f(1.1, -0.5)*/
+{62, 0,123,__LINE__, 0x3ff062c5, 0x09200ec3, 0x3ff19999, 0x9999999a, 0x3fd00000, 0x00000000},	/* 1.02411=f(1.1, 0.25)*/
+{62, 0,123,__LINE__, 0x3ff0c7eb, 0xc96a56f6, 0x3ff19999, 0x9999999a, 0x3fe00000, 0x00000000},	/* 1.04881=f(1.1, 0.5)*/
+{62, 0,123,__LINE__, 0x3ff08438, 0x278323a4, 0x3ff19999, 0x9999999a, 0x3fd55555, 0x55555555},	/* 1.03228=f(1.1, 0.333333)*/
+{62, 0,123,__LINE__, 0x3ff27583, 0x5d8e92dc, 0x3ff19999, 0x9999999a, 0x3ff80000, 0x00000000},	/* 1.15369=f(1.1, 1.5)*/
+{62, 0,123,__LINE__, 0x3ff35c28, 0xf5c28f5d, 0x3ff19999, 0x9999999a, 0x40000000, 0x00000000},	/* 1.21=f(1.1, 2)*/
+{62, 0,123,__LINE__, 0x3ff6c3e9, 0x1ed0825a, 0x3ff19999, 0x9999999a, 0x400d9999, 0x9999999a},	/* 1.42283=f(1.1, 3.7)*/
+{62, 0,123,__LINE__, 0x4004bffc, 0x0c03023e, 0x3ff19999, 0x9999999a, 0x40240000, 0x00000000},	/* 2.59374=f(1.1, 10)*/
+{62, 0,123,__LINE__, 0x403331c0, 0x6e0793ba, 0x3ff19999, 0x9999999a, 0x403f0000, 0x00000000},	/* 19.1943=f(1.1, 31)*/
+{62, 0,123,__LINE__, 0x3fbb8692, 0xe5b66fed, 0x3ff80000, 0x00000000, 0xc0160000, 0x00000000},	/* 0.107522=f(1.5, -5.5)*/
+{62, 0,123,__LINE__, 0x3fd2f684, 0xbda12f68, 0x3ff80000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.296296=f(1.5, -3)*/
+{62, 0,123,__LINE__, 0x3fe55555, 0x55555555, 0x3ff80000, 0x00000000, 0xbff00000, 0x00000000},	/* 0.666667=f(1.5, -1)*/
+{62, 0,123,__LINE__, 0x3fea20bd, 0x700c2c3e, 0x3ff80000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.816497=f(1.5, -0.5)*/
+{62, 0,123,__LINE__, 0x3ff1b4f8, 0x19c2ff81, 0x3ff80000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.10668=f(1.5, 0.25)*/
+{62, 0,123,__LINE__, 0x3ff3988e, 0x1409212e, 0x3ff80000, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.22474=f(1.5, 0.5)*/
+{62, 0,123,__LINE__, 0x3ff250bf, 0xe1b082f5, 0x3ff80000, 0x00000000, 0x3fd55555, 0x55555555},	/* 1.14471=f(1.5, 0.333333)*/
+{62, 0,123,__LINE__, 0x3ffd64d5, 0x1e0db1c6, 0x3ff80000, 0x00000000, 0x3ff80000, 0x00000000},	/* 1.83712=f(1.5, 1.5)*/
+{62, 0,123,__LINE__, 0x40020000, 0x00000000, 0x3ff80000, 0x00000000, 0x40000000, 0x00000000},	/* 2.25=f(1.5, 2)*/
+{62, 0,123,__LINE__, 0x4011ee43, 0x73c4daa9, 0x3ff80000, 0x00000000, 0x400d9999, 0x9999999a},	/* 4.48268=f(1.5, 3.7)*/
+{62, 0,123,__LINE__, 0x404cd520, 0x00000000, 0x3ff80000, 0x00000000, 0x40240000, 0x00000000},	/* 57.665=f(1.5, 10)*/
+{62, 0,123,__LINE__, 0x41118e2a, 0x5afb5158, 0x3ff80000, 0x00000000, 0x403f0000, 0x00000000},	/* 287627=f(1.5, 31)*/
+{62, 0,123,__LINE__, 0x3f96a09e, 0x667f3bcd, 0x40000000, 0x00000000, 0xc0160000, 0x00000000},	/* 0.0220971=f(2, -5.5)*/
+{62, 0,123,__LINE__, 0x3fc00000, 0x00000000, 0x40000000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.125=f(2, -3)*/
+{62, 0,123,__LINE__, 0x3fe00000, 0x00000000, 0x40000000, 0x00000000, 0xbff00000, 0x00000000},	/* 0.5=f(2, -1)*/
+{62, 0,123,__LINE__, 0x3fe6a09e, 0x667f3bcd, 0x40000000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.707107=f(2, -0.5)*/
+{62, 0,123,__LINE__, 0x3ff306fe, 0x0a31b715, 0x40000000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.18921=f(2, 0.25)*/
+{62, 0,123,__LINE__, 0x3ff6a09e, 0x667f3bcd, 0x40000000, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.41421=f(2, 0.5)*/
+{62, 0,123,__LINE__, 0x3ff428a2, 0xf98d728b, 0x40000000, 0x00000000, 0x3fd55555, 0x55555555},	/* 1.25992=f(2, 0.333333)*/
+{62, 0,123,__LINE__, 0x4006a09e, 0x667f3bcd, 0x40000000, 0x00000000, 0x3ff80000, 0x00000000},	/* 2.82843=f(2, 1.5)*/
+{62, 0,123,__LINE__, 0x40100000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000},	/* 4=f(2, 2)*/
+{62, 0,123,__LINE__, 0x4029fdf8, 0xbcce533e, 0x40000000, 0x00000000, 0x400d9999, 0x9999999a},	/* 12.996=f(2, 3.7)*/
+{62, 0,123,__LINE__, 0x40900000, 0x00000000, 0x40000000, 0x00000000, 0x40240000, 0x00000000},	/* 1024=f(2, 10)*/
+{62, 0,123,__LINE__, 0x41e00000, 0x00000000, 0x40000000, 0x00000000, 0x403f0000, 0x00000000},	/* 2.14748e+09=f(2, 31)*/
+{62, 0,123,__LINE__, 0x3f7a86f0, 0x875fcf94, 0x40040000, 0x00000000, 0xc0160000, 0x00000000},	/* 0.00647634=f(2.5, -5.5)*/
+{62, 0,123,__LINE__, 0x3fb0624d, 0xd2f1a9fc, 0x40040000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.064=f(2.5, -3)*/
+{62, 0,123,__LINE__, 0x3fd99999, 0x9999999a, 0x40040000, 0x00000000, 0xbff00000, 0x00000000},	/* 0.4=f(2.5, -1)*/
+{62, 0,123,__LINE__, 0x3fe43d13, 0x6248490f, 0x40040000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.632456=f(2.5, -0.5)*/
+{62, 0,123,__LINE__, 0x3ff41e72, 0x84162a49, 0x40040000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.25743=f(2.5, 0.25)*/
+{62, 0,123,__LINE__, 0x3ff94c58, 0x3ada5b53, 0x40040000, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.58114=f(2.5, 0.5)*/
+{62, 0,123,__LINE__, 0x3ff5b720, 0x9557b0ed, 0x40040000, 0x00000000, 0x3fd55555, 0x55555555},	/* 1.35721=f(2.5, 0.333333)*/
+{62, 0,123,__LINE__, 0x400f9f6e, 0x4990f227, 0x40040000, 0x00000000, 0x3ff80000, 0x00000000},	/* 3.95285=f(2.5, 1.5)*/
+{62, 0,123,__LINE__, 0x40190000, 0x00000000, 0x40040000, 0x00000000, 0x40000000, 0x00000000},	/* 6.25=f(2.5, 2)*/
+{62, 0,123,__LINE__, 0x403dac93, 0xf32d18dd, 0x40040000, 0x00000000, 0x400d9999, 0x9999999a},	/* 29.6741=f(2.5, 3.7)*/
+{62, 0,123,__LINE__, 0x40c2a05f, 0x20000000, 0x40040000, 0x00000000, 0x40240000, 0x00000000},	/* 9536.74=f(2.5, 10)*/
+{62, 0,123,__LINE__, 0x427f8def, 0x8808b024, 0x40040000, 0x00000000, 0x403f0000, 0x00000000},	/* 2.1684e+12=f(2.5, 31)*/
+{62, 0,123,__LINE__, 0x3f6376ae, 0x1d09b11b, 0x40080000, 0x00000000, 0xc0160000, 0x00000000},	/* 0.00237593=f(3, -5.5)*/
+{62, 0,123,__LINE__, 0x3fa2f684, 0xbda12f68, 0x40080000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.037037=f(3, -3)*/
+{62, 0,123,__LINE__, 0x3fd55555, 0x55555555, 0x40080000, 0x00000000, 0xbff00000, 0x00000000},	/* 0.333333=f(3, -1)*/
+{62, 0,123,__LINE__, 0x3fe279a7, 0x4590331c, 0x40080000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.57735=f(3, -0.5)*/
+{62, 0,123,__LINE__, 0x3ff50ea3, 0x9fcbf166, 0x40080000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.31607=f(3, 0.25)*/
+{62, 0,123,__LINE__, 0x3ffbb67a, 0xe8584caa, 0x40080000, 0x00000000, 0x3fe00000, 0x00000000},	/* 1.73205=f(3, 0.5)*/
+{62, 0,123,__LINE__, 0x3ff71374, 0x49123ef6, 0x40080000, 0x00000000, 0x3fd55555, 0x55555555},	/* 1.44225=f(3, 0.333333)*/
+{62, 0,123,__LINE__, 0x4014c8dc, 0x2e423980, 0x40080000, 0x00000000, 0x3ff80000, 0x00000000},	/* 5.19615=f(3, 1.5)*/
+{62, 0,123,__LINE__, 0x40220000, 0x00000000, 0x40080000, 0x00000000, 0x40000000, 0x00000000},	/* 9=f(3, 2)*/
+{62, 0,123,__LINE__, 0x404d20e7, 0xb0268253, 0x40080000, 0x00000000, 0x400d9999, 0x9999999a},	/* 58.2571=f(3, 3.7)*/
+{62, 0,123,__LINE__, 0x40ecd520, 0x00000000, 0x40080000, 0x00000000, 0x40240000, 0x00000000},	/* 59049=f(3, 10)*/
+{62, 0,123,__LINE__, 0x43018e2a, 0x5afb5158, 0x40080000, 0x00000000, 0x403f0000, 0x00000000},	/* 6.17673e+14=f(3, 31)*/
+{62, 0,123,__LINE__, 0x3ef794b6, 0xfd366467, 0x401c0000, 0x00000000, 0xc0160000, 0x00000000},	/* 2.24885e-05=f(7, -5.5)*/
+{62, 0,123,__LINE__, 0x3f67e225, 0x515a4f1d, 0x401c0000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.00291545=f(7, -3)*/
+{62, 0,123,__LINE__, 0x3fc24924, 0x92492492, 0x401c0000, 0x00000000, 0xbff00000, 0x00000000},	/* 0.142857=f(7, -1)*/
+{62, 0,123,__LINE__, 0x3fd83091, 0xe6a7f7e7, 0x401c0000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.377964=f(7, -0.5)*/
+{62, 0,123,__LINE__, 0x3ffa0675, 0x250ee9f2, 0x401c0000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.62658=f(7, 0.25)*/
+{62, 0,123,__LINE__, 0x40052a7f, 0xa9d2f8ea, 0x401c0000, 0x00000000, 0x3fe00000, 0x00000000},	/* 2.64575=f(7, 0.5)*/
+{62, 0,123,__LINE__, 0x3ffe9b5d, 0xba58189d, 0x401c0000, 0x00000000, 0x3fd55555, 0x55555555},	/* 1.91293=f(7, 0.333333)*/
+{62, 0,123,__LINE__, 0x4032852f, 0xb49899cd, 0x401c0000, 0x00000000, 0x3ff80000, 0x00000000},	/* 18.5203=f(7, 1.5)*/
+{62, 0,123,__LINE__, 0x40488000, 0x00000000, 0x401c0000, 0x00000000, 0x40000000, 0x00000000},	/* 49=f(7, 2)*/
+{62, 0,123,__LINE__, 0x4094ed03, 0x7391fd3c, 0x401c0000, 0x00000000, 0x400d9999, 0x9999999a},	/* 1339.25=f(7, 3.7)*/
+{62, 0,123,__LINE__, 0x41b0d63a, 0xf1000000, 0x401c0000, 0x00000000, 0x40240000, 0x00000000},	/* 2.82475e+08=f(7, 10)*/
+{62, 0,123,__LINE__, 0x45605047, 0x9325a57d, 0x401c0000, 0x00000000, 0x403f0000, 0x00000000},	/* 1.57775e+26=f(7, 31)*/
+{62, 0,123,__LINE__, 0x3eca86f0, 0x875fcf94, 0x40240000, 0x00000000, 0xc0160000, 0x00000000},	/* 3.16228e-06=f(10, -5.5)*/
+{62, 0,123,__LINE__, 0x3f50624d, 0xd2f1a9fc, 0x40240000, 0x00000000, 0xc0080000, 0x00000000},	/* 0.001=f(10, -3)*/
+{62, 0,123,__LINE__, 0x3fb99999, 0x9999999a, 0x40240000, 0x00000000, 0xbff00000, 0x00000000},	/* 0.1=f(10, -1)*/
+{62, 0,123,__LINE__, 0x3fd43d13, 0x6248490f, 0x40240000, 0x00000000, 0xbfe00000, 0x00000000},	/* 0.316228=f(10, -0.5)*/
+{62, 0,123,__LINE__, 0x3ffc73d5, 0x1c54470e, 0x40240000, 0x00000000, 0x3fd00000, 0x00000000},	/* 1.77828=f(10, 0.25)*/
+{62, 0,123,__LINE__, 0x40094c58, 0x3ada5b53, 0x40240000, 0x00000000, 0x3fe00000, 0x00000000},	/* 3.16228=f(10, 0.5)*/
+{62, 0,123,__LINE__, 0x40013c48, 0x4138704f, 0x40240000, 0x00000000, 0x3fd55555, 0x55555555},	/* 2.15443=f(10, 0.333333)*/
+{62, 0,123,__LINE__, 0x403f9f6e, 0x4990f227, 0x40240000, 0x00000000, 0x3ff80000, 0x00000000},	/* 31.6228=f(10, 1.5)*/
+{62, 0,123,__LINE__, 0x40590000, 0x00000000, 0x40240000, 0x00000000, 0x40000000, 0x00000000},	/* 100=f(10, 2)*/
+{62, 0,123,__LINE__, 0x40b393df, 0x516e1278, 0x40240000, 0x00000000, 0x400d9999, 0x9999999a},	/* 5011.87=f(10, 3.7)*/
+{62, 0,123,__LINE__, 0x4202a05f, 0x20000000, 0x40240000, 0x00000000, 0x40240000, 0x00000000},	/* 1e+10=f(10, 10)*/
+{62, 0,123,__LINE__, 0x465f8def, 0x8808b024, 0x40240000, 0x00000000, 0x403f0000, 0x00000000},	/* 1e+31=f(10, 31)*/
+{62, 0,123,__LINE__, 0x3d8b9aa2, 0x99d96f90, 0x405edd2f, 0x1a9fbe77, 0xc0160000, 0x00000000},	/* 3.13822e-12=f(123.456, -5.5)*/
+{62, 0,123,__LINE__, 0x3ea1d521, 0x8e6c760e, 0x405edd2f, 0x1a9fbe77, 0xc0080000, 0x00000000},	/* 5.31451e-07=f(123.456, -3)*/
+{62, 0,123,__LINE__, 0x3f8096c2, 0x8e0043f3, 0x405edd2f, 0x1a9fbe77, 0xbff00000, 0x00000000},	/* 0.00810005=f(123.456, -1)*/
+{62, 0,123,__LINE__, 0x3fb70a42, 0x4598b572, 0x405edd2f, 0x1a9fbe77, 0xbfe00000, 0x00000000},	/* 0.0900003=f(123.456, -0.5)*/
+{62, 0,123,__LINE__, 0x400aaaa7, 0xded649f5, 0x405edd2f, 0x1a9fbe77, 0x3fd00000, 0x00000000},	/* 3.33333=f(123.456, 0.25)*/
+{62, 0,123,__LINE__, 0x402638de, 0xe52c80ed, 0x405edd2f, 0x1a9fbe77, 0x3fe00000, 0x00000000},	/* 11.1111=f(123.456, 0.5)*/
+{62, 0,123,__LINE__, 0x4013ead4, 0xf488ee35, 0x405edd2f, 0x1a9fbe77, 0x3fd55555, 0x55555555},	/* 4.97933=f(123.456, 0.333333)*/
+{62, 0,123,__LINE__, 0x40956eea, 0x703cf8c4, 0x405edd2f, 0x1a9fbe77, 0x3ff80000, 0x00000000},	/* 1371.73=f(123.456, 1.5)*/
+{62, 0,123,__LINE__, 0x40cdc4b1, 0x24d099e1, 0x405edd2f, 0x1a9fbe77, 0x40000000, 0x00000000},	/* 15241.4=f(123.456, 2)*/
+{62, 0,123,__LINE__, 0x418a1e99, 0x0ab9a88c, 0x405edd2f, 0x1a9fbe77, 0x400d9999, 0x9999999a},	/* 5.47766e+07=f(123.456, 3.7)*/
+{62, 0,123,__LINE__, 0x44464b0e, 0xc57122fa, 0x405edd2f, 0x1a9fbe77, 0x40240000, 0x00000000},	/* 8.22474e+20=f(123.456, 10)*/
+{62, 0,123,__LINE__, 0x4d64df0c, 0x76040785, 0x405edd2f, 0x1a9fbe77, 0x403f0000, 0x00000000},	/* 6.86876e+64=f(123.456, 31)*/
+{62, 0,123,__LINE__, 0xc0200000, 0x00000000, 0xbfe00000, 0x00000000, 0xc0080000, 0x00000000},	/* -8=f(-0.5, -3)*/
+{62, 0,123,__LINE__, 0x40100000, 0x00000000, 0xbfe00000, 0x00000000, 0xc0000000, 0x00000000},	/* 4=f(-0.5, -2)*/
+{62, 0,123,__LINE__, 0xbfe00000, 0x00000000, 0xbfe00000, 0x00000000, 0x3ff00000, 0x00000000},	/* -0.5=f(-0.5, 1)*/
+{62, 0,123,__LINE__, 0x3fd00000, 0x00000000, 0xbfe00000, 0x00000000, 0x40000000, 0x00000000},	/* 0.25=f(-0.5, 2)*/
+{62, 0,123,__LINE__, 0xbfc00000, 0x00000000, 0xbfe00000, 0x00000000, 0x40080000, 0x00000000},	/* -0.125=f(-0.5, 3)*/
+{62, 0,123,__LINE__, 0xbf800000, 0x00000000, 0xbfe00000, 0x00000000, 0x401c0000, 0x00000000},	/* -0.0078125=f(-0.5, 7)*/
+{62, 0,123,__LINE__, 0xbfc00000, 0x00000000, 0xc0000000, 0x00000000, 0xc0080000, 0x00000000},	/* -0.125=f(-2, -3)*/
+{62, 0,123,__LINE__, 0x3fd00000, 0x00000000, 0xc0000000, 0x00000000, 0xc0000000, 0x00000000},	/* 0.25=f(-2, -2)*/
+{62, 0,123,__LINE__, 0xc0000000, 0x00000000, 0xc0000000, 0x00000000, 0x3ff00000, 0x00000000},	/* -2=f(-2, 1)*/
+{62, 0,123,__LINE__, 0x40100000, 0x00000000, 0xc0000000, 0x00000000, 0x40000000, 0x00000000},	/* 4=f(-2, 2)*/
+{62, 0,123,__LINE__, 0xc0200000, 0x00000000, 0xc0000000, 0x00000000, 0x40080000, 0x00000000},	/* -8=f(-2, 3)*/
+{62, 0,123,__LINE__, 0xc0600000, 0x00000000, 0xc0000000, 0x00000000, 0x401c0000, 0x00000000},	/* -128=f(-2, 7)*/
+{62, 0,123,__LINE__, 0xbfa2f684, 0xbda12f68, 0xc0080000, 0x00000000, 0xc0080000, 0x00000000},	/* -0.037037=f(-3, -3)*/
+{62, 0,123,__LINE__, 0x3fbc71c7, 0x1c71c71c, 0xc0080000, 0x00000000, 0xc0000000, 0x00000000},	/* 0.111111=f(-3, -2)*/
+{62, 0,123,__LINE__, 0xc0080000, 0x00000000, 0xc0080000, 0x00000000, 0x3ff00000, 0x00000000},	/* -3=f(-3, 1)*/
+{62, 0,123,__LINE__, 0x40220000, 0x00000000, 0xc0080000, 0x00000000, 0x40000000, 0x00000000},	/* 9=f(-3, 2)*/
+{62, 0,123,__LINE__, 0xc03b0000, 0x00000000, 0xc0080000, 0x00000000, 0x40080000, 0x00000000},	/* -27=f(-3, 3)*/
+{62, 0,123,__LINE__, 0xc0a11600, 0x00000000, 0xc0080000, 0x00000000, 0x401c0000, 0x00000000},	/* -2187=f(-3, 7)*/
+{62, 0,123,__LINE__, 0xbf50624d, 0xd2f1a9fc, 0xc0240000, 0x00000000, 0xc0080000, 0x00000000},	/* -0.001=f(-10, -3)*/
+{62, 0,123,__LINE__, 0x3f847ae1, 0x47ae147b, 0xc0240000, 0x00000000, 0xc0000000, 0x00000000},	/* 0.01=f(-10, -2)*/
+{62, 0,123,__LINE__, 0xc0240000, 0x00000000, 0xc0240000, 0x00000000, 0x3ff00000, 0x00000000},	/* -10=f(-10, 1)*/
+{62, 0,123,__LINE__, 0x40590000, 0x00000000, 0xc0240000, 0x00000000, 0x40000000, 0x00000000},	/* 100=f(-10, 2)*/
+{62, 0,123,__LINE__, 0xc08f4000, 0x00000000, 0xc0240000, 0x00000000, 0x40080000, 0x00000000},	/* -1000=f(-10, 3)*/
+{62, 0,123,__LINE__, 0xc16312d0, 0x00000000, 0xc0240000, 0x00000000, 0x401c0000, 0x00000000},	/* -1e+07=f(-10, 7)*/
+{62, 0,123,__LINE__, 0x00000000, 0x00000001, 0x40000000, 0x00000000, 0xc090c800, 0x00000000},	/* 4.94066e-324=f(2, -1074)*/
+{62, 0,123,__LINE__, 0x7fe00000, 0x00000000, 0x40000000, 0x00000000, 0x408ff800, 0x00000000},	/* 8.98847e+307=f(2, 1023)*/
+{62, 0,123,__LINE__, 0x7fe1ccf3, 0x85ebc8a0, 0x40240000, 0x00000000, 0x40734000, 0x00000000},	/* 1e+308=f(10, 308)*/
+{62, 0,123,__LINE__, 0x0031fa18, 0x2c40c60d, 0x40240000, 0x00000000, 0xc0733000, 0x00000000},	/* 1e-307=f(10, -307)*/
+{62, 0,123,__LINE__, 0x40000000, 0x00000000, 0x40100000, 0x00000000, 0x3fe00000, 0x00000000},	/* 2=f(4, 0.5)*/
+{62, 0,123,__LINE__, 0x3fc00000, 0x00000000, 0x3fd00000, 0x00000000, 0x3ff80000, 0x00000000},	/* 0.125=f(0.25, 1.5)*/
+{62, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x3ff00000, 0x00000000, 0x7e37e43c, 0x8800759c},	/* 1=f(1, 1e+300)*/
+{62, 0,123,__LINE__, 0x3ff00000, 0x00000000, 0x40140000, 0x00000000, 0x00000000, 0x00000000},	/* 1=f(5, 0)*/
+{62, 0,123,__LINE__, 0x4005bf0a, 0xa93f93c0, 0x3ff00000, 0x0006df38, 0x4202a05f, 0x20000000},	/* 2.71828=f(1, 1e+10)*/
+{62, 0,123,__LINE__, 0x3fd78b56, 0x1579033b, 0x3fefffff, 0xfff24190, 0x4202a05f, 0x20000000},	/* 0.367879=f(1, 1e+10)*/
+{62, 0,123,__LINE__, 0x3fb99999, 0x99999999, 0x3ddb7cdf, 0xd9d7bdbb, 0x3fb99999, 0x9999999a},	/* 0.1=f(1e-10, 0.1)*/
+{62, 0,123,__LINE__, 0x7ed754e3, 0x1cd07303, 0x7e37e43c, 0x8800759c, 0x3ff028f5, 0xc28f5c29},	/* 1e+303=f(1e+300, 1.01)*/
+{62, 0,123,__LINE__, 0x3055ff2a, 0x9f12a79e, 0x3ee4aba9, 0x66f3a002, 0x402e0290, 0xfc641d78},	/* 7.5987e-76=f(9.85649e-06, 15.005)*/
+{62, 0,123,__LINE__, 0x4e82af1e, 0x3663eee3, 0x3e4502fc, 0x8714c28c, 0xc02187f5, 0x1e75678c},	/* 1.61191e+70=f(9.78432e-09, -8.76554)*/
+{62, 0,123,__LINE__, 0x4eaf47e8, 0xe84eca93, 0x41babbdd, 0xca942e70, 0x40206ba4, 0xab471896},	/* 1.07946e+71=f(4.4852e+08, 8.21024)*/
+{62, 0,123,__LINE__, 0x27aa655d, 0x8d82843e, 0x3e6617d9, 0x476b77f5, 0x402fa6cf, 0xd1a3070c},	/* 1.30843e-117=f(4.11517e-08, 15.8258)*/
+{62, 0,123,__LINE__, 0x450fecc9, 0xe474f92d, 0x40707d26, 0x111abaca, 0x40246374, 0x64e5310c},	/* 4.82436e+24=f(263.822, 10.1942)*/
+{62, 0,123,__LINE__, 0x474c9362, 0x748bcaa2, 0x41856141, 0xe8fe54a2, 0x40128b2f, 0x21d9757c},	/* 2.96747e+35=f(4.48369e+07, 4.63592)*/
+{62, 0,123,__LINE__, 0x49216651, 0x0af2b8d2, 0x3f03379a, 0x2023a08e, 0xc023f7cf, 0x02926484},	/* 1.94013e+44=f(3.66539e-05, -9.984)*/
+{62, 0,123,__LINE__, 0x625c63c3, 0xa61c3586, 0x41d5ffa8, 0xe6cc9097, 0x40321582, 0x1f6847a4},	/* 6.53941e+165=f(1.47631e+09, 18.084)*/
+{62, 0,123,__LINE__, 0x4103cb63, 0x46b3ad52, 0x3f99c804, 0x141d1c72, 0xc00a10e8, 0x482e0cd8},	/* 162156=f(0.0251771, -3.25826)*/
+{62, 0,123,__LINE__, 0x3937df4d, 0x1fe2ac33, 0x40e393b7, 0x354eb530, 0xc01c19ca, 0x3c42b270},	/* 4.59763e-33=f(40093.7, -7.02519)*/
+{62, 0,123,__LINE__, 0x3352d2f1, 0x3ae85247, 0x4102719d, 0x557c79f6, 0xc0277446, 0x592e08ec},	/* 1.83034e-61=f(151092, -11.7271)*/
+{62, 0,123,__LINE__, 0x3267201d, 0x51e1c7a1, 0x3eeb1b7e, 0xc35c9f8f, 0x402aa8e2, 0x4bf45ad8},	/* 6.86216e-66=f(1.29258e-05, 13.3299)*/
+{62, 0,123,__LINE__, 0x46773901, 0xd0d9e251, 0x4202beda, 0x90f5c7c8, 0x40092b0c, 0xd3cdf3c0},	/* 2.94382e+31=f(1.00639e+10, 3.14602)*/
+{62, 0,123,__LINE__, 0x42cc801b, 0xc87c04d6, 0x3fc123fc, 0x87b6b633, 0xc02f9a0c, 0x3723f2ce},	/* 6.26731e+13=f(0.133911, -15.8009)*/
+{62, 0,123,__LINE__, 0x4232f5c5, 0xd9c1163e, 0x4027db76, 0xefe843ee, 0x402444e7, 0xe2280d14},	/* 8.14328e+10=f(11.9286, 10.1346)*/
+{62, 0,123,__LINE__, 0x4063d69f, 0xe8de9102, 0x3f820fba, 0xff2a68d9, 0xbff1231a, 0x40640b40},	/* 158.707=f(0.00881907, -1.07107)*/
+{62, 0,123,__LINE__, 0x63965650, 0x91e63fc2, 0x3de7481a, 0x8da1be9c, 0xc0319354, 0xb171879e},	/* 5.39518e+171=f(1.69396e-10, -17.5755)*/
+{62, 0,123,__LINE__, 0x2d3c17c5, 0x0cc04fa5, 0x3e5088f3, 0x5db65295, 0x40270e78, 0x9b2108fc},	/* 8.6194e-91=f(1.53994e-08, 11.5283)*/
+{62, 0,123,__LINE__, 0x3f40d997, 0x0c271b61, 0x3fe4d5ba, 0x721f3682, 0x4031a5de, 0x8f6e199a},	/* 0.00051422=f(0.65109, 17.6479)*/
+{62, 0,123,__LINE__, 0x3874f199, 0x241f5d74, 0x40c66153, 0x0a83318b, 0xc021bdb6, 0x1fd1caca},	/* 9.8477e-37=f(11458.6, -8.87053)*/
+{62, 0,123,__LINE__, 0x4031565c, 0xf7cc6f66, 0x3ff4d202, 0x191ba55c, 0x4025aaa7, 0x3298f0bc},	/* 17.3374=f(1.30127, 10.8333)*/
+{62, 0,123,__LINE__, 0x46dbef9b, 0x4f33b5f9, 0x3e7665f1, 0x51c90a5a, 0xc012d936, 0x324358f6},	/* 2.26643e+33=f(8.34398e-08, -4.71212)*/
+{62, 0,123,__LINE__, 0x3de89fb3, 0x449b3ad3, 0x3f39accf, 0x498f1732, 0x4006e2fa, 0x29387690},	/* 1.79162e-10=f(0.00039177, 2.86083)*/
+{62, 0,123,__LINE__, 0x3ca31f65, 0xd22350a2, 0x3f65b8c8, 0xbeb29634, 0x4018a635, 0x62ab22bc},	/* 1.3269e-16=f(0.00265159, 6.16231)*/
+{62, 0,123,__LINE__, 0x5e445bff, 0xaab2ac2a, 0x3e462ad1, 0xcbf1d6e4, 0xc0324b67, 0x11ba914e},	/* 1.27114e+146=f(1.03224e-08, -18.2945)*/
+{62, 0,123,__LINE__, 0x3b3daf3e, 0xab761dde, 0x40596ab7, 0xbe9e5d38, 0xc026876a, 0x6dc0ad06},	/* 2.45545e-23=f(101.667, -11.2645)*/
+{62, 0,123,__LINE__, 0x49d9026e, 0x5ddfecfa, 0x40d0a89f, 0x69c0d824, 0x402691d5, 0x0d0c25dc},	/* 5.71116e+47=f(17058.5, 11.2848)*/
+{62, 0,123,__LINE__, 0x30a97307, 0xf1fa22cb, 0x4174e156, 0x69a7d9c5, 0xc0240a48, 0xc6be0dd6},	/* 2.81325e-74=f(2.18945e+07, -10.0201)*/
+{62, 0,123,__LINE__, 0x42837deb, 0x4261007c, 0x4011c206, 0xc73f8b91, 0x403332e1, 0x1530b642},	/* 2.67894e+12=f(4.43948, 19.1987)*/
+{62, 0,123,__LINE__, 0x3152dfb9, 0x3aadfd6d, 0x3f12de87, 0xcd87c0d5, 0x4030fc69, 0x62c1c466},	/* 4.2729e-71=f(7.19805e-05, 16.986)*/
+{62, 0,123,__LINE__, 0x4adb655a, 0xdf4d66c5, 0x4224989a, 0x741eb864, 0x4013c4c4, 0x904382b8},	/* 4.10001e+52=f(4.42298e+10, 4.94216)*/
+{62, 0,123,__LINE__, 0x6efab415, 0xc44742c6, 0x3d6418ee, 0x8614c728, 0xc032820a, 0x868341d6},	/* 3.9537e+226=f(5.71202e-13, -18.508)*/
+{62, 0,123,__LINE__, 0x40f8aa36, 0x49215404, 0x3fd6986a, 0x0d653ac3, 0xc02622bb, 0x7e8f0708},	/* 101027=f(0.353053, -11.0678)*/
+{62, 0,123,__LINE__, 0x19b36abb, 0xc994e1e4, 0x4206c122, 0xeab8e6d6, 0xc0324183, 0xf922a445},	/* 7.14008e-185=f(1.22162e+10, -18.2559)*/
+{62, 0,123,__LINE__, 0x5aa13436, 0x83e17bfc, 0x3dcdf489, 0x055285be, 0xc0290db9, 0x24010aaa},	/* 3.72663e+128=f(5.44882e-11, -12.5268)*/
+{62, 0,123,__LINE__, 0x4065c1a5, 0xff239259, 0x400523ae, 0x594dce2b, 0x40153d10, 0xeb5b7b98},	/* 174.052=f(2.64242, 5.30963)*/
+{62, 0,123,__LINE__, 0x44d41353, 0x12c65cad, 0x40cd4669, 0x10c99610, 0x4016961e, 0x21f71a60},	/* 3.79215e+23=f(14988.8, 5.6466)*/
+{62, 0,123,__LINE__, 0x2e8624d6, 0xa202cb95, 0x41360750, 0xccb36461, 0xc02b39a4, 0x3684ee24},	/* 1.42484e-84=f(1.44366e+06, -13.6126)*/
+{62, 0,123,__LINE__, 0x49433a5f, 0x3dfd14b6, 0x4094ebe9, 0x5527dc84, 0x402cbdb1, 0x9eb5fae0},	/* 8.57598e+44=f(1338.98, 14.3705)*/
+{62, 0,123,__LINE__, 0x54dc2b82, 0x1e7961d0, 0x4222be13, 0x5c61870e, 0x40230225, 0xecf36148},	/* 6.16148e+100=f(4.02492e+10, 9.5042)*/
+{62, 0,123,__LINE__, 0x1fe6ef93, 0xb8202d26, 0x426817d9, 0x56fbbe9c, 0xc029e397, 0x64d5dc38},	/* 5.34573e-155=f(8.27835e+11, -12.9445)*/
+{62, 0,123,__LINE__, 0x3d378f47, 0x68eab109, 0x41d8f5b9, 0xc07421d6, 0xbff6af10, 0xbaf45210},	/* 8.37008e-14=f(1.67503e+09, -1.41774)*/
+{62, 0,123,__LINE__, 0x3f2b6d6e, 0x89c2d38d, 0x40352855, 0x1129814a, 0xc00634fd, 0x35a38b10},	/* 0.000209255=f(21.1575, -2.77587)*/
+{62, 0,123,__LINE__, 0x3bf781f5, 0x0ddad6ca, 0x3f9344ba, 0x12e34a90, 0x40262344, 0x3cd338fa},	/* 7.9647e-20=f(0.0188169, 11.0689)*/
+{62, 0,123,__LINE__, 0x4c807fa1, 0x281bed2c, 0x41567dad, 0x1e2d2f8c, 0x4021e0a6, 0x48ab3cc4},	/* 3.31402e+60=f(5.89586e+06, 8.93877)*/
+{62, 0,123,__LINE__, 0x27359ade, 0x706985de, 0x3d7986e4, 0x1f854695, 0x40241e06, 0x69300e4c},	/* 8.36672e-120=f(1.45104e-12, 10.0586)*/
+{62, 0,123,__LINE__, 0x287024eb, 0x60d95bf3, 0x3e85c4ea, 0x4cf8daaa, 0x4030ab51, 0x3cd61556},	/* 6.55569e-114=f(1.62193e-07, 16.6692)*/
+{62, 0,123,__LINE__, 0x2faae66b, 0x8a608f55, 0x3e374f12, 0xd8629a70, 0x4022f4f1, 0xdaca071e},	/* 4.53738e-79=f(5.42702e-09, 9.47841)*/
+{62, 0,123,__LINE__, 0x45174a5d, 0xfd70ecc4, 0x3d8b5e80, 0x5faf1077, 0xc0014650, 0xec202de8},	/* 7.03912e+24=f(3.11151e-12, -2.15933)*/
+{62, 0,123,__LINE__, 0x4c5be9c8, 0xd591bcc4, 0x42645d8a, 0x105f5b58, 0x401435ad, 0xb0640668},	/* 7.00857e+59=f(6.99749e+11, 5.05242)*/
+{62, 0,123,__LINE__, 0x46c5728f, 0x293ed15b, 0x40e25a62, 0x220dd9f9, 0x401ccca1, 0xcb22fd88},	/* 8.70014e+32=f(37587.1, 7.19984)*/
+{62, 0,123,__LINE__, 0x3a043cde, 0xcbd8b105, 0x3f23b856, 0x35656a31, 0x401dd177, 0xc4487674},	/* 3.19296e-29=f(0.000150452, 7.45456)*/
+{62, 0,123,__LINE__, 0x42045f3e, 0x009ae4ca, 0x40c2fce4, 0xe94d6312, 0x400423b6, 0x9f29de58},	/* 1.09372e+10=f(9721.79, 2.51744)*/
+{62, 0,123,__LINE__, 0x3fb98bd7, 0x288d8ef1, 0x3fd18503, 0x758465e3, 0x3ffc7666, 0xb9fa8550},	/* 0.09979=f(0.273744, 1.77891)*/
+{62, 0,123,__LINE__, 0x36923007, 0x87517e44, 0x3d97dc99, 0x0f7e4aee, 0x40100353, 0xe923ef3c},	/* 7.96446e-46=f(5.42552e-12, 4.00325)*/
+{62, 0,123,__LINE__, 0x23a9f1c5, 0x4067404f, 0x4175ac24, 0xac5d19f9, 0xc0328221, 0xdb7e7f06},	/* 6.97165e-137=f(2.27252e+07, -18.5083)*/
+{62, 0,123,__LINE__, 0x42926a70, 0xbc103674, 0x3f62985b, 0xcb888345, 0xc013384d, 0xa5b51f3c},	/* 5.06209e+12=f(0.00226992, -4.80498)*/
+{62, 0,123,__LINE__, 0x468218fb, 0x0285fd12, 0x3e055f49, 0xd25f65f4, 0xc00b8369, 0x6cded158},	/* 4.58828e+31=f(6.22013e-10, -3.43917)*/
+{62, 0,123,__LINE__, 0x59de8bab, 0xee08670c, 0x3db25ec5, 0xa8a111f2, 0xc0272e1e, 0x79274f22},	/* 8.07694e+124=f(1.67076e-11, -11.5901)*/
+{62, 0,123,__LINE__, 0x4d563c32, 0xb456ab8b, 0x3e0452fd, 0x8842974b, 0xc01bfc58, 0xe00e3b60},	/* 3.6588e+64=f(5.91512e-10, -6.99643)*/
+0,};
+test_pow_vec(m)   {run_vector_1(m,pow_vec,(char *)(pow),"pow","ddd");   }	
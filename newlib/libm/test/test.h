@@ -30,6 +30,18 @@ typedef struct
 } one_line_type;
 
 
+/* A line of a vector for a function of three arguments, such as fma.  */
+typedef struct 
+{
+  char error_bit;
+  char errno_val;
+  char merror;
+  int line;
+  
+  question_struct_type qs[4];
+} three_line_type;
+
+
 #define MVEC_START(x) one_line_type x[] =  {
 #define MVEC_END    0,};
 
@@ -0,0 +1,97 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Write hash tables in both byte orders, sync them halfway through and
+   at the end, then read every record back read-write and read-only.  */
+
+#define __DBINTERFACE_PRIVATE
+#include <sys/types.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../../libc/search/db_local.h"
+#include "check.h"
+
+#define NKEYS	3000
+#define DBFILE	"hashlorder.db"
+
+static void
+check_all (DB *db)
+{
+  char k[32], v[64];
+  DBT key, val;
+  int i, n;
+
+  for (i = 0; i < NKEYS; i++)
+    {
+      key.data = k;
+      key.size = sprintf (k, "key%d", i);
+      CHECK (db->get (db, &key, &val, 0) == 0);
+      n = sprintf (v, "value-%d-%0*d", i, i % 40, 0);
+      CHECK (val.size == n && memcmp (val.data, v, n) == 0);
+    }
+
+  n = 0;
+  for (i = db->seq (db, &key, &val, R_FIRST); i == 0;
+       i = db->seq (db, &key, &val, R_NEXT))
+    n++;
+  CHECK (i == 1);
+  CHECK (n == NKEYS);
+}
+
+static void
+test (int lorder)
+{
+  char k[32], v[64];
+  HASHINFO info;
+  DBT key, val;
+  DB *db;
+  int i;
+
+  memset (&info, 0, sizeof info);
+  info.bsize = 256;
+  info.cachesize = 4096;
+  info.lorder = lorder;
+
+  unlink (DBFILE);
+  db = __hash_open (DBFILE, O_RDWR | O_CREAT | O_TRUNC, 0644, 0, &info);
+  CHECK (db != NULL);
+  for (i = 0; i < NKEYS; i++)
+    {
+      key.data = k;
+      key.size = sprintf (k, "key%d", i);
+      val.data = v;
+      val.size = sprintf (v, "value-%d-%0*d", i, i % 40, 0);
+      CHECK (db->put (db, &key, &val, 0) == 0);
+      /* The pages left in the pool must still be usable after a sync.  */
+      if (i == NKEYS / 2)
+	CHECK (db->sync (db, 0) == 0);
+    }
+  CHECK (db->sync (db, 0) == 0);
+  check_all (db);
+  CHECK (db->close (db) == 0);
+
+  db = __hash_open (DBFILE, O_RDWR, 0, 0, NULL);
+  CHECK (db != NULL);
+  check_all (db);
+  CHECK (db->close (db) == 0);
+
+  db = __hash_open (DBFILE, O_RDONLY, 0, 0, NULL);
+  CHECK (db != NULL);
+  check_all (db);
+  CHECK (db->close (db) == 0);
+
+  unlink (DBFILE);
+}
+
+int
+main (void)
+{
+  test (1234);
+  test (4321);
+  exit (0);
+}
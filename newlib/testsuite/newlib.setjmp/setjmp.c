@@ -0,0 +1,101 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+
+static jmp_buf env;
+
+static void __attribute__ ((noinline))
+jump (int val)
+{
+  longjmp (env, val);
+}
+
+/* Go some frames down, dirtying the callee-saved registers on the way,
+   before jumping back.  */
+static int __attribute__ ((noinline))
+deep (int n, int val)
+{
+  volatile char pad[64];
+  int a = n * 3, b = n * 5, c = n * 7, d = n * 11;
+
+  memset ((char *) pad, n, sizeof pad);
+  if (n == 0)
+    jump (val);
+  return deep (n - 1, val) + a + b + c + d + pad[n % 64];
+}
+
+int
+main (void)
+{
+  volatile int count = 0;
+  int keep1 = 12345, keep2 = 67890;
+  int ret;
+
+  /* setjmp returns 0 when called, and longjmp's value when jumped to,
+     except that longjmp (env, 0) makes it return 1.  */
+  ret = setjmp (env);
+  if (count++ == 0)
+    jump (0);
+  CHECK (ret == 1);
+
+  count = 0;
+  ret = setjmp (env);
+  if (count++ == 0)
+    jump (42);
+  CHECK (ret == 42);
+
+  count = 0;
+  ret = setjmp (env);
+  if (count++ == 0)
+    jump (-1);
+  CHECK (ret == -1);
+
+  /* Non-volatile locals that are not changed after setjmp keep their
+     values, and the stack is usable after jumping out of a deep call.  */
+  ret = setjmp (env);
+  if (ret == 0)
+    deep (100, 7);
+  CHECK (ret == 7);
+  CHECK (keep1 == 12345 && keep2 == 67890);
+
+  /* A volatile local changed between setjmp and longjmp keeps the
+     new value.  */
+  count = 0;
+  ret = setjmp (env);
+  if (++count < 1000)
+    jump (count);
+  CHECK (ret == 999 && count == 1000);
+
+#ifdef _setjmp
+  count = 0;
+  ret = _setjmp (env);
+  if (count++ == 0)
+    _longjmp (env, 0);
+  CHECK (ret == 1);
+#endif
+
+#ifdef sigsetjmp
+  {
+    static sigjmp_buf senv;
+
+    count = 0;
+    ret = sigsetjmp (senv, 0);
+    if (count++ == 0)
+      siglongjmp (senv, 0);
+    CHECK (ret == 1);
+
+    ret = sigsetjmp (senv, 1);
+    if (ret == 0)
+      siglongjmp (senv, 3);
+    CHECK (ret == 3);
+  }
+#endif
+
+  exit (0);
+}
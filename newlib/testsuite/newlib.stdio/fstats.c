@@ -0,0 +1,144 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Per-stream I/O statistics and the trace hook, which exist only when
+   newlib is configured with --enable-newlib-stdio-stats.  */
+
+#include <newlib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "check.h"
+
+#ifdef _WANT_STDIO_STATS
+
+#include <string.h>
+#include <stdio_ext.h>
+
+#define FILE_NAME "fstats.out"
+
+static FILE *traced;
+static int nread, nwrite, nseek;
+static long long read_bytes, write_asked, write_bytes;
+static int last_whence;
+static long long last_seek;
+
+static void
+trace (FILE *fp, int op, __int64_t arg, int whence, __int64_t ret)
+{
+  if (fp != traced)
+    return;
+  switch (op)
+    {
+    case __FTRACE_READ:
+      nread++;
+      if (ret > 0)
+	read_bytes += ret;
+      break;
+    case __FTRACE_WRITE:
+      nwrite++;
+      write_asked += arg;
+      if (ret > 0)
+	write_bytes += ret;
+      break;
+    case __FTRACE_SEEK:
+      nseek++;
+      last_whence = whence;
+      last_seek = ret;
+      break;
+    }
+}
+
+static int
+find (FILE *fp, const struct __sstats *st, void *arg)
+{
+  return fp == arg && st->_nwritten == 100;
+}
+
+int
+main (void)
+{
+  struct __sstats st, zero;
+  char buf[100], in[100];
+  FILE *fp, *out;
+  int i;
+
+  memset (buf, 'x', sizeof buf);
+  memset (&zero, 0, sizeof zero);
+
+  fp = fopen (FILE_NAME, "w+");
+  CHECK (fp != NULL);
+  CHECK (__fstats (fp, &st) == 0);
+  CHECK (memcmp (&st, &zero, sizeof st) == 0);
+  traced = fp;
+  CHECK (__fsettrace (trace) == NULL);
+
+  /* Fully buffered writes go out a buffer at a time.  */
+  CHECK (setvbuf (fp, NULL, _IOFBF, 64) == 0);
+  for (i = 0; i < 10; i++)
+    CHECK (fwrite (buf, 1, 10, fp) == 10);
+  CHECK (fflush (fp) == 0);
+  CHECK (__fstats (fp, &st) == 0);
+  CHECK (st._nbufmode == 1);
+  CHECK (st._nwritten == 100);
+  CHECK (st._nread == 0);
+  CHECK (st._nsyscall == 2);
+  CHECK (st._nflush >= 1);
+  CHECK (nwrite == 2 && write_asked == 100 && write_bytes == 100);
+  CHECK (__fwalk_stats (find, fp) == 1);
+
+  /* Reading back.  */
+  CHECK (fseek (fp, 0, SEEK_SET) == 0);
+  CHECK (nseek >= 1 && last_whence == SEEK_SET && last_seek == 0);
+  CHECK (fread (in, 1, sizeof in, fp) == sizeof in);
+  CHECK (memcmp (in, buf, sizeof in) == 0);
+  CHECK (__fstats (fp, &st) == 0);
+  CHECK (st._nread == 100);
+  CHECK (st._nrefill >= 1);
+  CHECK (read_bytes == 100);
+  CHECK (st._nsyscall == (unsigned long) (nread + nwrite + nseek));
+
+  /* Unbuffered, every character is a write of its own.  */
+  __fstats_reset (fp);
+  CHECK (__fstats (fp, &st) == 0);
+  CHECK (memcmp (&st, &zero, sizeof st) == 0);
+  nwrite = 0;
+  CHECK (setvbuf (fp, NULL, _IONBF, 0) == 0);
+  CHECK (fseek (fp, 0, SEEK_END) == 0);
+  CHECK (fputc ('a', fp) == 'a');
+  CHECK (fputc ('b', fp) == 'b');
+  CHECK (fputc ('c', fp) == 'c');
+  CHECK (__fstats (fp, &st) == 0);
+  CHECK (st._nbufmode == 1);
+  CHECK (st._nwritten == 3);
+  CHECK (nwrite == 3);
+
+  /* Without a trace function, the counters still run.  */
+  CHECK (__fsettrace (NULL) == trace);
+  CHECK (fputc ('d', fp) == 'd');
+  CHECK (nwrite == 3);
+  CHECK (__fstats (fp, &st) == 0);
+  CHECK (st._nwritten == 4);
+
+  out = fopen ("/dev/null", "w");
+  if (out != NULL)
+    {
+      CHECK (__fdump_stats (out) == 0);
+      fclose (out);
+    }
+
+  CHECK (fclose (fp) == 0);
+  remove (FILE_NAME);
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  exit (0);
+}
+
+#endif
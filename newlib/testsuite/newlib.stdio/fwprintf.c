@@ -0,0 +1,155 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Wide output to a byte stream: characters that encode as themselves,
+   multibyte characters across buffer flushes, L'\0', and characters
+   the locale cannot encode.  */
+
+#include <errno.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include "check.h"
+
+#define FILE_NAME "fwprintf.out"
+#define LONG_LEN 10000
+
+static char got[4 * LONG_LEN];
+
+/* Open FILE_NAME for wide output with a buffer of BUFLEN bytes.  */
+static FILE *
+open_out (size_t buflen)
+{
+  FILE *fp = fopen (FILE_NAME, "w+");
+
+  CHECK (fp != NULL);
+  CHECK (setvbuf (fp, NULL, _IOFBF, buflen) == 0);
+  CHECK (fwide (fp, 1) > 0);
+  return fp;
+}
+
+/* Close FP and return the number of bytes written to it, read into GOT.  */
+static size_t
+read_back (FILE *fp)
+{
+  size_t n;
+
+  clearerr (fp);
+  rewind (fp);
+  n = fread (got, 1, sizeof (got), fp);
+  CHECK (fclose (fp) == 0);
+  return n;
+}
+
+static void
+test_ascii (void)
+{
+  FILE *fp = open_out (BUFSIZ);
+  int ret;
+
+  ret = fwprintf (fp, L"%ls=%d;%5.2ls|", L"key", 42, L"value");
+  CHECK (ret == 13);
+  CHECK (fputws (L"plain text\n", fp) >= 0);
+  CHECK (!ferror (fp));
+  CHECK (read_back (fp) == 24);
+  CHECK (memcmp (got, "key=42;   va|plain text\n", 24) == 0);
+}
+
+/* %lc writes L'\0' as a zero byte, and a precision cuts %ls short.  */
+static void
+test_nul (void)
+{
+  FILE *fp = open_out (BUFSIZ);
+  int ret;
+
+  ret = fwprintf (fp, L"a%lcb%.2lsc%3lc", (wint_t) L'\0', L"xyz",
+		  (wint_t) L'\0');
+  CHECK (ret == 9);
+  CHECK (read_back (fp) == 9);
+  CHECK (memcmp (got, "a\0bxyc  \0", 9) == 0);
+}
+
+/* In the C locale a character above UCHAR_MAX cannot be converted.  What
+   comes before it is written, and the stream is marked in error.  */
+static void
+test_unconvertible (void)
+{
+  FILE *fp = open_out (BUFSIZ);
+  int ret;
+
+  errno = 0;
+  ret = fwprintf (fp, L"ok%lcno", (wint_t) 0x100);
+  CHECK (ret < 0);
+  CHECK (errno == EILSEQ);
+  CHECK (ferror (fp));
+  CHECK (read_back (fp) == 2);
+  CHECK (memcmp (got, "ok", 2) == 0);
+
+  fp = open_out (BUFSIZ);
+  errno = 0;
+  CHECK (fputws (L"ab\x100", fp) == -1);
+  CHECK (errno == EILSEQ);
+  CHECK (fclose (fp) == 0);
+}
+
+/* Mix one, two and three byte UTF-8 characters over more than BUFSIZ
+   wide characters, so that conversions straddle the internal buffers
+   and the stream's small one.  */
+static void
+test_utf8 (void)
+{
+  static wchar_t ws[LONG_LEN + 1];
+  static char want[4 * LONG_LEN];
+  size_t i, n = 0;
+  FILE *fp;
+  int ret;
+
+  for (i = 0; i < LONG_LEN; i++)
+    switch (i % 7)
+      {
+      case 3:
+	ws[i] = 0xe9;
+	want[n++] = '\xc3';
+	want[n++] = '\xa9';
+	break;
+      case 5:
+	ws[i] = 0x20ac;
+	want[n++] = '\xe2';
+	want[n++] = '\x82';
+	want[n++] = '\xac';
+	break;
+      default:
+	ws[i] = 'a' + i % 26;
+	want[n++] = 'a' + i % 26;
+	break;
+      }
+  ws[LONG_LEN] = L'\0';
+
+  fp = open_out (61);
+  ret = fwprintf (fp, L"%ls", ws);
+  CHECK (ret == LONG_LEN);
+  CHECK (!ferror (fp));
+  CHECK (read_back (fp) == n);
+  CHECK (memcmp (got, want, n) == 0);
+
+  fp = open_out (61);
+  CHECK (fputws (ws, fp) >= 0);
+  CHECK (read_back (fp) == n);
+  CHECK (memcmp (got, want, n) == 0);
+}
+
+int
+main (void)
+{
+  test_ascii ();
+  test_nul ();
+  test_unconvertible ();
+  if (setlocale (LC_CTYPE, "C.UTF-8") != NULL)
+    test_utf8 ();
+  remove (FILE_NAME);
+  exit (0);
+}
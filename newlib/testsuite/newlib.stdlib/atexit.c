@@ -1,11 +1,21 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <malloc.h>
 
 void a(void);
 void b(void);
 void c(int, void *);
 static void newline(void);
 
+/* Not declared by any header.  */
+int __cxa_atexit(void (*)(void *), void *, void *);
+void __cxa_finalize(void *);
+
+/* DSO handles.  */
+static char dso_a, dso_b, dso_c, dso_d, dso_e, dso_f, dso_g, dso_h;
+
+static int count;
+
 void a (void)
 {
   printf("a");
@@ -27,8 +37,101 @@ static void newline (void)
   printf("\n");
 }
 
+static void put (void *k)
+{
+  printf("%s", (char *)k);
+}
+
+static void counter (void *k)
+{
+  count++;
+}
+
+/* Register more handlers while __cxa_finalize runs this one.  */
+static void nest (void *k)
+{
+  printf("%s", (char *)k);
+  __cxa_atexit(put, "7", &dso_c);
+  __cxa_atexit(put, "x", &dso_d);
+  __cxa_atexit(put, "8", &dso_c);
+}
+
+/* Take as much of the heap as malloc gives, up to 256 MB, so that
+   __cxa_atexit cannot allocate its per-DSO index and drops it.  The
+   blocks are chained through their first word.  */
+static void *exhaust (void)
+{
+  void *list = NULL, *p;
+  size_t size, total = 0;
+
+  for (size = 1 << 20; size >= sizeof (void *); size /= 2)
+    while (total < (256 << 20) && (p = malloc(size)) != NULL)
+      {
+	*(void **)p = list;
+	list = p;
+	total += size;
+      }
+  return list;
+}
+
+static void release (void *list)
+{
+  void *next;
+
+  for (; list != NULL; list = next)
+    {
+      next = *(void **)list;
+      free(list);
+    }
+}
+
 int main()
 {
+  size_t used;
+  void *heap;
+  int i;
+
+  /* Each DSO's handlers, most recent first.  */
+  __cxa_atexit(put, "1", &dso_a);
+  __cxa_atexit(put, "4", &dso_b);
+  __cxa_atexit(put, "2", &dso_a);
+  __cxa_atexit(put, "5", &dso_b);
+  __cxa_atexit(put, "3", &dso_a);
+  __cxa_finalize(&dso_a);
+  printf("-");
+  __cxa_finalize(&dso_b);
+  printf("\n");
+
+  /* Handlers registered by a handler of the same DSO run next, those of
+     another DSO wait for it.  */
+  __cxa_atexit(put, "9", &dso_c);
+  __cxa_atexit(nest, "6", &dso_c);
+  __cxa_finalize(&dso_c);
+  printf("-");
+  __cxa_finalize(&dso_d);
+  printf("\n");
+
+  /* Blocks of handlers, and the index, are freed once all their
+     handlers have run.  */
+  used = mallinfo().uordblks;
+  for (i = 0; i < 100; i++)
+    __cxa_atexit(counter, NULL, i % 2 ? &dso_e : &dso_f);
+  __cxa_finalize(&dso_e);
+  __cxa_finalize(&dso_f);
+  printf("%d %s\n", count, mallinfo().uordblks == used ? "freed" : "leaked");
+
+  /* Without the index, __cxa_finalize scans all handlers.  */
+  fflush(stdout);
+  heap = exhaust();
+  __cxa_atexit(put, "a", &dso_g);
+  __cxa_atexit(put, "c", &dso_h);
+  __cxa_atexit(put, "b", &dso_g);
+  release(heap);
+  __cxa_finalize(&dso_g);
+  printf("-");
+  __cxa_finalize(&dso_h);
+  printf("\n");
+
   if (atexit(newline) != 0)
     abort();
 
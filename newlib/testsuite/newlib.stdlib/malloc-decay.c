@@ -0,0 +1,129 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Large free chunks that cannot be trimmed have their pages given back
+   once M_DECAY_TIME has passed, or at once by malloc_trim.  mallinfo
+   reports the pages given back in fsmblks.  Only the Linux port's
+   malloc has M_DECAY_TIME.  */
+
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "check.h"
+
+#ifdef M_DECAY_TIME
+
+#define NBLOCKS 200
+#define BLOCK (48 * 1024)
+#define DECAY 100
+#define LIMIT 5000
+
+static char *block[NBLOCKS];
+
+static long
+elapsed (struct timeval *t0)
+{
+  struct timeval t;
+
+  gettimeofday (&t, NULL);
+  return (t.tv_sec - t0->tv_sec) * 1000 + (t.tv_usec - t0->tv_usec) / 1000;
+}
+
+static void
+alloc_blocks (void)
+{
+  int i;
+
+  for (i = 0; i < NBLOCKS; i++)
+    {
+      CHECK ((block[i] = malloc (BLOCK)) != NULL);
+      memset (block[i], i, BLOCK);
+    }
+}
+
+static void
+free_blocks (void)
+{
+  int i;
+
+  for (i = 0; i < NBLOCKS; i++)
+    free (block[i]);
+}
+
+/* The small calls that give malloc the chance to purge.  They are
+   served from a chunk freed between two blocks in use, which is an
+   exact fit, so they leave the large free chunk alone.  */
+static void
+churn (int n)
+{
+  while (n-- > 0)
+    free (malloc (32));
+}
+
+int
+main (void)
+{
+  struct timeval t0;
+  char *spacer, *small, *pin, *carved[10];
+  int i;
+
+  CHECK (mallopt (M_MMAP_THRESHOLD, 4 * BLOCK) == 1);
+  CHECK (mallopt (M_DECAY_TIME, DECAY) == 1);
+
+  /* The pinned block keeps the freed ones away from the top.  */
+  alloc_blocks ();
+  CHECK ((spacer = malloc (64)) != NULL);
+  CHECK ((small = malloc (32)) != NULL);
+  CHECK ((pin = malloc (64)) != NULL);
+  free (small);
+  CHECK (mallinfo ().fsmblks < BLOCK);
+
+  free_blocks ();
+  gettimeofday (&t0, NULL);
+  while (mallinfo ().fsmblks < NBLOCKS / 2 * BLOCK)
+    {
+      CHECK (elapsed (&t0) < LIMIT);
+      churn (100);
+    }
+
+  /* Carving small blocks out of the purged chunk keeps the rest of it
+     released.  */
+  for (i = 0; i < 10; i++)
+    CHECK ((carved[i] = malloc (1000)) != NULL);
+  CHECK (mallinfo ().fsmblks >= NBLOCKS / 2 * BLOCK);
+  for (i = 0; i < 10; i++)
+    free (carved[i]);
+
+  /* The chunks are still usable.  */
+  alloc_blocks ();
+  for (i = 0; i < NBLOCKS; i++)
+    CHECK (block[i][0] == (char) i && block[i][BLOCK - 1] == (char) i);
+  CHECK (mallinfo ().fsmblks < BLOCK);
+
+  /* -1 only purges through malloc_trim.  */
+  CHECK (mallopt (M_DECAY_TIME, -1) == 1);
+  free_blocks ();
+  gettimeofday (&t0, NULL);
+  while (elapsed (&t0) < 2 * DECAY)
+    churn (100);
+  CHECK (mallinfo ().fsmblks < BLOCK);
+  malloc_trim (0);
+  CHECK (mallinfo ().fsmblks >= NBLOCKS / 2 * BLOCK);
+
+  free (spacer);
+  free (pin);
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  exit (0);
+}
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Parallel constructors run before main, level by level: every one of a
+   level returns before any of the next level starts.  They are defined
+   here out of level order, so that link order alone gets it wrong.
+   Only the Linux port has parallel constructors.  */
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "check.h"
+
+#ifdef __linux__
+
+#include <sys/pinit.h>
+
+enum { D, A, B, C, A2, C2, NFN };
+
+static const int level[NFN] = { -1, 0, 1, 2, 0, 2 };
+static volatile int ticket;
+static int start[NFN], end[NFN], runs[NFN];
+
+static void
+run (int i)
+{
+  start[i] = __sync_fetch_and_add (&ticket, 1);
+  /* Give the others of the level time to overlap.  */
+  usleep (10000);
+  __sync_fetch_and_add (&runs[i], 1);
+  end[i] = __sync_fetch_and_add (&ticket, 1);
+}
+
+PARALLEL_CONSTRUCTOR (c, 2) { run (C); }
+PARALLEL_CONSTRUCTOR (a, 0) { run (A); }
+PARALLEL_CONSTRUCTOR (d, -1) { run (D); }
+PARALLEL_CONSTRUCTOR (b, 1) { run (B); }
+PARALLEL_CONSTRUCTOR (a2, 0) { run (A2); }
+PARALLEL_CONSTRUCTOR (c2, 2) { run (C2); }
+
+int
+main (void)
+{
+  int i, j;
+
+  for (i = 0; i < NFN; i++)
+    CHECK (runs[i] == 1);
+  for (i = 0; i < NFN; i++)
+    for (j = 0; j < NFN; j++)
+      if (level[i] < level[j])
+	CHECK (end[i] < start[j]);
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  exit (0);
+}
+
+#endif
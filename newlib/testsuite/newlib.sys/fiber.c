@@ -0,0 +1,172 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Fibers: creating, yielding, switching and joining, waiting for a
+   descriptor, and the per-fiber struct _reent.  Only the Linux port has
+   fibers.  */
+
+#include <stdlib.h>
+#include "check.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/fiber.h>
+
+static int order[16], norder;
+static int pfd[2];
+
+/* Record ID three times, yielding in between.  */
+static void *
+counter (void *arg)
+{
+  int id = (int) (long) arg, i;
+
+  for (i = 0; i < 3; i++)
+    {
+      order[norder++] = id * 10 + i;
+      fiber_yield ();
+    }
+  return (void *) (long) (id + 100);
+}
+
+/* errno and strtok keep their state in the fiber's struct _reent.  */
+static void *
+reentrant (void *arg)
+{
+  char buf[16];
+  const char *sep = arg;
+  char *tok;
+  int i;
+
+  strcpy (buf, sep[0] == ' ' ? "a b c" : "x,y,z");
+  errno = sep[0];
+  tok = strtok (buf, sep);
+  for (i = 0; tok != NULL; i++)
+    {
+      CHECK (*tok == (sep[0] == ' ' ? "abc" : "xyz")[i]);
+      fiber_yield ();
+      CHECK (errno == sep[0]);
+      tok = strtok (NULL, sep);
+    }
+  return (void *) (long) i;
+}
+
+static void *
+reader (void *arg)
+{
+  char c = 0;
+  int ev;
+
+  ev = fiber_wait_fd (pfd[0], EPOLLIN);
+  CHECK (ev >= 0 && (ev & EPOLLIN));
+  CHECK (read (pfd[0], &c, 1) == 1);
+  return (void *) (long) c;
+}
+
+static void *
+writer (void *arg)
+{
+  /* Let the reader block first.  */
+  fiber_yield ();
+  order[norder++] = 1;
+  CHECK (write (pfd[1], arg, 1) == 1);
+  return NULL;
+}
+
+static void *
+record (void *arg)
+{
+  order[norder++] = (int) (long) arg;
+  return NULL;
+}
+
+int
+main (void)
+{
+  fiber_t f[4];
+  void *ret;
+  int ev;
+  char c;
+
+  /* Fibers take turns in the order they were created.  */
+  CHECK (fiber_create (&f[0], 0, counter, (void *) 1) == 0);
+  CHECK (fiber_create (&f[1], 0, counter, (void *) 2) == 0);
+  CHECK (norder == 0);
+  CHECK (fiber_join (f[0], &ret) == 0);
+  CHECK (ret == (void *) 101);
+  CHECK (fiber_join (f[1], &ret) == 0);
+  CHECK (ret == (void *) 102);
+  CHECK (norder == 6);
+  CHECK (order[0] == 10 && order[1] == 20 && order[2] == 11);
+  CHECK (order[3] == 21 && order[4] == 12 && order[5] == 22);
+
+  /* fiber_switch runs the fiber at once, ahead of the queue.  */
+  norder = 0;
+  CHECK (fiber_create (&f[0], 0, record, (void *) 1) == 0);
+  CHECK (fiber_create (&f[1], 16384, record, (void *) 2) == 0);
+  CHECK (fiber_switch (f[1]) == 0);
+  CHECK (norder == 2 && order[0] == 2 && order[1] == 1);
+  CHECK (fiber_switch (f[1]) == EINVAL);
+  CHECK (fiber_join (f[0], NULL) == 0);
+  CHECK (fiber_join (f[1], NULL) == 0);
+
+  /* A fiber cannot join itself.  */
+  CHECK (fiber_join (fiber_self (), NULL) == EDEADLK);
+
+  /* Each fiber has its own errno and strtok state, and the main
+     fiber's are left alone.  */
+  errno = 77;
+  CHECK (fiber_create (&f[0], 0, reentrant, " ") == 0);
+  CHECK (fiber_create (&f[1], 0, reentrant, ",") == 0);
+  CHECK (fiber_join (f[0], &ret) == 0);
+  CHECK (ret == (void *) 3);
+  CHECK (fiber_join (f[1], &ret) == 0);
+  CHECK (ret == (void *) 3);
+  CHECK (errno == 77);
+
+  /* A fiber waiting for a descriptor lets the others run until it is
+     ready.  */
+  CHECK (pipe (pfd) == 0);
+  norder = 0;
+  CHECK (fiber_create (&f[0], 0, reader, NULL) == 0);
+  CHECK (fiber_create (&f[1], 0, writer, "r") == 0);
+  CHECK (fiber_join (f[0], &ret) == 0);
+  CHECK (ret == (void *) 'r');
+  CHECK (norder == 1);
+  CHECK (fiber_join (f[1], NULL) == 0);
+
+  /* So does the main fiber, and the same descriptor can be waited for
+     again.  */
+  CHECK (fiber_create (&f[0], 0, writer, "m") == 0);
+  ev = fiber_wait_fd (pfd[0], EPOLLIN);
+  CHECK (ev >= 0 && (ev & EPOLLIN));
+  CHECK (read (pfd[0], &c, 1) == 1 && c == 'm');
+  CHECK (fiber_join (f[0], NULL) == 0);
+
+  /* A fiber switched to that blocks hands back to the one that switched
+     to it.  */
+  CHECK (fiber_create (&f[0], 0, reader, NULL) == 0);
+  CHECK (fiber_switch (f[0]) == 0);
+  CHECK (write (pfd[1], "s", 1) == 1);
+  CHECK (fiber_join (f[0], &ret) == 0);
+  CHECK (ret == (void *) 's');
+
+  close (pfd[0]);
+  close (pfd[1]);
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  exit (0);
+}
+
+#endif
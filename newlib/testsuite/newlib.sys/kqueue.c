@@ -0,0 +1,205 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* kqueue and kevent, which the Linux port builds on epoll and timerfd.  */
+
+#include <stdlib.h>
+#include "check.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/event.h>
+
+#define MAXFD 256
+
+static struct timespec zero = { 0, 0 };
+
+static int
+nopen (void)
+{
+  int fd, n = 0;
+
+  for (fd = 0; fd < MAXFD; fd++)
+    if (fcntl (fd, F_GETFD) >= 0)
+      n++;
+  return n;
+}
+
+/* Collect the events there are now.  */
+static int
+poll_kq (int kq, struct kevent *ev, int nev)
+{
+  return kevent (kq, NULL, 0, ev, nev, &zero);
+}
+
+static int
+count (struct kevent *ev, int n, int filter, uintptr_t ident)
+{
+  int i, c = 0;
+
+  for (i = 0; i < n; i++)
+    if (ev[i].filter == filter && ev[i].ident == ident)
+      c++;
+  return c;
+}
+
+int
+main (void)
+{
+  struct kevent ch[8], ev[8];
+  struct timespec ts;
+  int kq, p[2], q[2], n, fds;
+  char c, buf[4];
+
+  fds = nopen ();
+  kq = kqueue ();
+  CHECK (kq >= 0);
+  CHECK (pipe (p) == 0);
+  CHECK (pipe (q) == 0);
+
+  /* Level-triggered read: reported for as long as there is data.  */
+  EV_SET (&ch[0], p[0], EVFILT_READ, EV_ADD, 0, 0, (void *) 1);
+  CHECK (kevent (kq, ch, 1, NULL, 0, NULL) == 0);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 0);
+  CHECK (write (p[1], "ab", 2) == 2);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 1);
+  CHECK (ev[0].ident == (uintptr_t) p[0] && ev[0].filter == EVFILT_READ);
+  CHECK (ev[0].udata == (void *) 1);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 1);
+  CHECK (read (p[0], &c, 1) == 1);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 1);
+  CHECK (read (p[0], &c, 1) == 1);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 0);
+
+  /* EV_CLEAR: reported once per arrival of data.  */
+  EV_SET (&ch[0], q[0], EVFILT_READ, EV_ADD | EV_CLEAR, 0, 0, (void *) 2);
+  CHECK (kevent (kq, ch, 1, NULL, 0, NULL) == 0);
+  CHECK (write (q[1], "ab", 2) == 2);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 1 && ev[0].udata == (void *) 2);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 0);
+  CHECK (write (q[1], "c", 1) == 1);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 1);
+  CHECK (read (q[0], buf, 3) == 3);
+
+  /* EV_DELETE, and deleting what is not there.  */
+  EV_SET (&ch[0], q[0], EVFILT_READ, EV_DELETE, 0, 0, NULL);
+  CHECK (kevent (kq, ch, 1, NULL, 0, NULL) == 0);
+  CHECK (write (q[1], "d", 1) == 1);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 0);
+  n = kevent (kq, ch, 1, NULL, 0, NULL);
+  CHECK (n == -1 && errno == ENOENT);
+  CHECK (read (q[0], &c, 1) == 1);
+
+  /* EV_ONESHOT: reported once, then gone.  */
+  EV_SET (&ch[0], p[1], EVFILT_WRITE, EV_ADD | EV_ONESHOT, 0, 0, NULL);
+  CHECK (kevent (kq, ch, 1, NULL, 0, NULL) == 0);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 1 && ev[0].filter == EVFILT_WRITE);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 0);
+  EV_SET (&ch[0], p[1], EVFILT_WRITE, EV_DELETE, 0, 0, NULL);
+  n = kevent (kq, ch, 1, NULL, 0, NULL);
+  CHECK (n == -1 && errno == ENOENT);
+
+  /* Timers: periodic, one-shot and deleted.  */
+  EV_SET (&ch[0], 1, EVFILT_TIMER, EV_ADD, 0, 10, (void *) 3);
+  EV_SET (&ch[1], 2, EVFILT_TIMER, EV_ADD | EV_ONESHOT, 0, 10, NULL);
+  EV_SET (&ch[2], 3, EVFILT_TIMER, EV_ADD, 0, 10, NULL);
+  EV_SET (&ch[3], 3, EVFILT_TIMER, EV_DELETE, 0, 0, NULL);
+  CHECK (kevent (kq, ch, 4, NULL, 0, NULL) == 0);
+  ts.tv_sec = 0;
+  ts.tv_nsec = 50 * 1000000;
+  nanosleep (&ts, NULL);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 2);
+  CHECK (count (ev, n, EVFILT_TIMER, 1) == 1);
+  CHECK (count (ev, n, EVFILT_TIMER, 2) == 1);
+  CHECK (count (ev, n, EVFILT_TIMER, 3) == 0);
+  CHECK (ev[0].data >= 1 && ev[1].data >= 1);
+  CHECK (ev[ev[0].ident == 1 ? 0 : 1].data >= 2);
+  n = kevent (kq, NULL, 0, ev, 8, NULL);
+  CHECK (n == 1 && ev[0].ident == 1 && ev[0].udata == (void *) 3);
+  EV_SET (&ch[0], 2, EVFILT_TIMER, EV_DELETE, 0, 0, NULL);
+  n = kevent (kq, ch, 1, NULL, 0, NULL);
+  CHECK (n == -1 && errno == ENOENT);
+  EV_SET (&ch[0], 1, EVFILT_TIMER, EV_DELETE, 0, 0, NULL);
+  CHECK (kevent (kq, ch, 1, NULL, 0, NULL) == 0);
+
+  /* A batch of changes, one of them bad, reports the bad one as an
+     EV_ERROR event and applies the others.  */
+  EV_SET (&ch[0], p[0], EVFILT_READ, EV_ADD, 0, 0, NULL);
+  EV_SET (&ch[1], p[1], EVFILT_WRITE, EV_ADD, 0, 0, NULL);
+  EV_SET (&ch[2], MAXFD - 1, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+  EV_SET (&ch[3], q[1], EVFILT_WRITE, EV_ADD, 0, 0, NULL);
+  n = kevent (kq, ch, 4, ev, 8, &zero);
+  CHECK (n == 1);
+  CHECK (ev[0].flags == EV_ERROR && ev[0].data == ENOENT);
+  CHECK (ev[0].ident == MAXFD - 1);
+  CHECK (write (p[1], "e", 1) == 1);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 3);
+  CHECK (count (ev, n, EVFILT_READ, p[0]) == 1);
+  CHECK (count (ev, n, EVFILT_WRITE, p[1]) == 1);
+  CHECK (count (ev, n, EVFILT_WRITE, q[1]) == 1);
+
+  /* An event list with less room than there are events hands them out
+     over several calls, none lost or repeated.  */
+  n = poll_kq (kq, ev, 1);
+  CHECK (n == 1);
+  n += poll_kq (kq, ev + 1, 1);
+  CHECK (n == 2);
+  n += poll_kq (kq, ev + 2, 1);
+  CHECK (n == 3);
+  CHECK (count (ev, n, EVFILT_READ, p[0]) == 1);
+  CHECK (count (ev, n, EVFILT_WRITE, p[1]) == 1);
+  CHECK (count (ev, n, EVFILT_WRITE, q[1]) == 1);
+  CHECK (read (p[0], &c, 1) == 1);
+
+  /* Closing the write end reports EV_EOF.  */
+  EV_SET (&ch[0], p[1], EVFILT_WRITE, EV_DELETE, 0, 0, NULL);
+  EV_SET (&ch[1], q[1], EVFILT_WRITE, EV_DELETE, 0, 0, NULL);
+  CHECK (kevent (kq, ch, 2, NULL, 0, NULL) == 0);
+  CHECK (close (p[1]) == 0);
+  n = poll_kq (kq, ev, 8);
+  CHECK (n == 1 && (ev[0].flags & EV_EOF));
+
+  /* Closing the kqueue also closes the timerfds behind its timers.  */
+  EV_SET (&ch[0], 4, EVFILT_TIMER, EV_ADD, 0, 1000, NULL);
+  EV_SET (&ch[1], 5, EVFILT_TIMER, EV_ADD, 0, 1000, NULL);
+  CHECK (kevent (kq, ch, 2, NULL, 0, NULL) == 0);
+  CHECK (close (kq) == 0);
+  CHECK (close (p[0]) == 0);
+  CHECK (close (q[0]) == 0);
+  CHECK (close (q[1]) == 0);
+  CHECK (nopen () == fds);
+  n = kevent (kq, NULL, 0, ev, 8, &zero);
+  CHECK (n == -1 && errno == EBADF);
+
+  exit (0);
+}
+
+#else
+
+int
+main (void)
+{
+  exit (0);
+}
+
+#endif
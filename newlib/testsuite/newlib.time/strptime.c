@@ -0,0 +1,100 @@
+/*
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* strptime must read back what strftime writes, and a format compiled
+   with strptime_compile must parse exactly like the same strptime call.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "check.h"
+
+static const char *formats[] = {
+  "%Y-%m-%d %H:%M:%S",
+  "%a %b %e %T %Y",
+  "%A, %B %d %Y %I:%M:%S %p",
+  "%d/%b/%Y:%H:%M:%S",
+  "%F %R:%S",
+  "%c",
+  "%D %T",
+};
+
+static const char *bad[] = {
+  "",
+  "2023-13",
+  "Thurs Oct",
+  "10/Octember/2023:13:55:36",
+  "2023-10-10 13:55",
+};
+
+int
+main (void)
+{
+  strptime_t compiled[sizeof formats / sizeof formats[0]];
+  struct tm tm, a, b;
+  char buf[128], *ea, *eb;
+  time_t t;
+  unsigned i, j;
+
+  for (i = 0; i < sizeof formats / sizeof formats[0]; i++)
+    CHECK ((compiled[i] = strptime_compile (formats[i])) != NULL);
+
+  /* Every 37 hours and a bit from 1970 to 2037.  */
+  for (t = 0; t < 0x7f000000; t += 133337)
+    {
+      gmtime_r (&t, &tm);
+      for (i = 0; i < sizeof formats / sizeof formats[0]; i++)
+	{
+	  CHECK (strftime (buf, sizeof buf, formats[i], &tm) > 0);
+	  memset (&a, 0, sizeof a);
+	  memset (&b, 0, sizeof b);
+	  ea = strptime (buf, formats[i], &a);
+	  eb = strptime_exec (compiled[i], buf, &b);
+	  CHECK (ea != NULL && *ea == '\0');
+	  CHECK (eb == ea);
+	  CHECK (a.tm_year == tm.tm_year);
+	  CHECK (a.tm_mon == tm.tm_mon);
+	  CHECK (a.tm_mday == tm.tm_mday);
+	  CHECK (a.tm_hour == tm.tm_hour);
+	  CHECK (a.tm_min == tm.tm_min);
+	  CHECK (a.tm_sec == tm.tm_sec);
+	  CHECK (a.tm_yday == tm.tm_yday);
+	  CHECK (memcmp (&a, &b, sizeof a) == 0);
+	}
+    }
+
+  /* Day of the year and year alone give the whole date.  */
+  memset (&a, 0, sizeof a);
+  CHECK (strptime ("366 2024", "%j %Y", &a) != NULL);
+  CHECK (a.tm_mon == 11 && a.tm_mday == 31 && a.tm_wday == 2);
+
+  /* Names match without regard to case, and the first one that is a
+     prefix of the input wins, so "%b" takes "Mar" from "March".  */
+  memset (&a, 0, sizeof a);
+  ea = strptime ("tUESDAY march", "%A %b", &a);
+  CHECK (ea != NULL && strcmp (ea, "ch") == 0);
+  CHECK (a.tm_wday == 2 && a.tm_mon == 2);
+  memset (&b, 0, sizeof b);
+  eb = strptime_exec (compiled[0], "2023-10-10 13:55:36 tail", &b);
+  CHECK (eb != NULL && strcmp (eb, " tail") == 0);
+
+  for (i = 0; i < sizeof formats / sizeof formats[0]; i++)
+    for (j = 0; j < sizeof bad / sizeof bad[0]; j++)
+      {
+	memset (&a, 0, sizeof a);
+	memset (&b, 0, sizeof b);
+	ea = strptime (bad[j], formats[i], &a);
+	eb = strptime_exec (compiled[i], bad[j], &b);
+	CHECK (ea == NULL);
+	CHECK (eb == NULL);
+      }
+
+  for (i = 0; i < sizeof formats / sizeof formats[0]; i++)
+    strptime_free (compiled[i]);
+  strptime_free (NULL);
+
+  exit (0);
+}
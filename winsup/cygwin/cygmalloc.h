@@ -22,6 +22,17 @@ int __reg1 dlmalloc_trim (size_t);
 int __reg2 dlmallopt (int p, int v);
 void dlmalloc_stats ();
 
+/* Threads allocate from a small pool of mspaces.  Chunk footers name
+   the owning space, so a block freed or reallocated by another thread
+   goes back where it came from.  */
+void *create_mspace (size_t capacity, int locked);
+void *mspace_malloc (void *msp, size_t bytes);
+void *mspace_calloc (void *msp, size_t nmemb, size_t size);
+void *mspace_memalign (void *msp, size_t alignment, size_t bytes);
+int mspace_trim (void *msp, size_t pad);
+void mspace_malloc_stats (void *msp);
+void *mspace_owner (void *p);
+
 #ifdef __x86_64__
 #define MALLOC_ALIGNMENT ((size_t)16U)
 #endif
@@ -33,12 +44,15 @@ void *mmap64 (void *, size_t, int, int, int, off_t);
 # define mmap mmap64
 # define MALLOC_FAILURE_ACTION	__set_ENOMEM ()
 # define USE_DL_PREFIX 1
+# define MSPACES 1
+# define FOOTERS 1
 
 #elif defined (__INSIDE_CYGWIN__)
 
-# define __malloc_lock() mallock.acquire ()
-# define __malloc_unlock() mallock.release ()
-extern muto mallock;
+# define __malloc_lock() malloc_lock ()
+# define __malloc_unlock() malloc_unlock ()
+bool malloc_lock ();
+void malloc_unlock ();
 
 #endif
 
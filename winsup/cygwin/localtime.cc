@@ -16,6 +16,7 @@
 #include "cygerrno.h"
 #include "sync.h"
 #include <ctype.h>
+#include <sys/stat.h>
 #define STD_INSPIRED
 #define lint
 
@@ -429,6 +430,7 @@ struct __state {
 	int		charcnt;
 	int		goback;
 	int		goahead;
+	int		lasthit;	/* transition found by the last localsub */
 	time_t		ats[TZ_MAX_TIMES];
 	unsigned char	types[TZ_MAX_TIMES];
 	struct ttinfo	ttis[TZ_MAX_TYPES];
@@ -508,6 +510,7 @@ static void		tzset_unlocked(void);
 static long		leapcorr(const timezone_t sp, time_t * timep);
 
 static timezone_t lclptr;
+static timezone_t lclbuf;	/* lclptr when the zone is not cached */
 static timezone_t gmtptr;
 
 #ifndef TZ_STRLEN_MAX
@@ -1525,13 +1528,14 @@ tzsetwall (void)
 		return;
 	lcl_is_set = lcl_setting;
 
-	if (lclptr == NULL) {
+	if (lclbuf == NULL) {
 		save_errno save;
-		lclptr = (timezone_t) calloc(1, sizeof *lclptr);
-		if (lclptr == NULL) {
-			settzname();	/* all we can do */
-			return;
-		}
+		lclbuf = (timezone_t) calloc(1, sizeof *lclbuf);
+	}
+	lclptr = lclbuf;
+	if (lclptr == NULL) {
+		settzname();	/* all we can do */
+		return;
 	}
 #if defined (__CYGWIN__)
 	{
@@ -1617,6 +1621,95 @@ tzsetwall (void)
 	settzname();
 }
 
+/*
+** Zones loaded by tzset_unlocked, so that a program switching TZ back and
+** forth does not read and parse the zone file each time.  An entry is
+** keyed by the TZ value and the identity of the file it names, so a zone
+** file replaced on disk is loaded again.  lclptr points into the cache
+** while TZ names a cached zone, and to lclbuf otherwise.
+*/
+#define TZ_CACHE_SIZE	4
+
+struct tzcache {
+	char		name[TZ_STRLEN_MAX + 1];
+	dev_t		dev;		/* identity of the zone file, */
+	ino_t		ino;		/* all zero if there is none */
+	off_t		size;
+	time_t		mtime;
+	long		offset[2];	/* __tzrule offsets set by loading */
+	unsigned long	used;		/* for replacing the oldest entry */
+	int		loaded;
+	timezone_t	sp;
+};
+
+static struct tzcache	tzcache[TZ_CACHE_SIZE];
+static unsigned long	tzcache_clock;
+
+/*
+** Return the cache entry for NAME.  If it holds the zone, make its tzinfo
+** offsets current; otherwise the caller loads the zone into it and calls
+** tzcache_done.  Return NULL if no entry can be allocated.
+*/
+static struct tzcache *
+tzcache_get(const char *const name)
+{
+	struct tzcache *	tc;
+	struct tzcache *	victim;
+	struct stat		st;
+	const char *		file = name;
+	char			fullname[FILENAME_MAX + 1];
+	save_errno		save;
+
+	if (strlen(name) >= sizeof tc->name)
+		return NULL;
+	/* Resolve the file name as tzload does. */
+	if (file[0] == ':')
+		++file;
+	if (file[0] != '/') {
+		if (strlen(TZDIR) + strlen(file) + 1 >= sizeof fullname)
+			return NULL;
+		(void) strcpy(fullname, TZDIR "/");
+		(void) strcat(fullname, file);
+		file = fullname;
+	}
+	if (stat(file, &st) != 0)
+		memset(&st, 0, sizeof st);
+
+	victim = tzcache;
+	for (tc = tzcache; tc < tzcache + TZ_CACHE_SIZE; ++tc) {
+		if (tc->loaded && strcmp(tc->name, name) == 0 &&
+		    tc->dev == st.st_dev && tc->ino == st.st_ino &&
+		    tc->size == st.st_size && tc->mtime == st.st_mtime) {
+			tc->used = ++tzcache_clock;
+			__gettzinfo ()->__tzrule[0].offset = tc->offset[0];
+			__gettzinfo ()->__tzrule[1].offset = tc->offset[1];
+			return tc;
+		}
+		if (tc->used < victim->used)
+			victim = tc;
+	}
+	tc = victim;
+	if (tc->sp == NULL &&
+	    (tc->sp = (timezone_t) calloc(1, sizeof *tc->sp)) == NULL)
+		return NULL;
+	(void) strcpy(tc->name, name);
+	tc->dev = st.st_dev;
+	tc->ino = st.st_ino;
+	tc->size = st.st_size;
+	tc->mtime = st.st_mtime;
+	tc->used = ++tzcache_clock;
+	tc->loaded = FALSE;
+	return tc;
+}
+
+static void
+tzcache_done(struct tzcache *const tc)
+{
+	tc->offset[0] = __gettzinfo ()->__tzrule[0].offset;
+	tc->offset[1] = __gettzinfo ()->__tzrule[1].offset;
+	tc->loaded = TRUE;
+}
+
 static NO_COPY muto tzset_guard;
 
 #ifdef __CYGWIN__
@@ -1634,6 +1727,7 @@ void
 tzset_unlocked(void)
 {
 	const char *	name;
+	struct tzcache *	tc = NULL;
 
 	name = getenv("TZ");
 	if (name == NULL) {
@@ -1648,9 +1742,18 @@ tzset_unlocked(void)
 	if (lcl_is_set != lcl_unset)
 		(void)strlcpy(lcl_TZname, name, sizeof (lcl_TZname));
 
-	if (lclptr == NULL) {
-		save_errno save;
-		lclptr = (timezone_t) calloc(1, sizeof *lclptr);
+	if (*name != '\0' && (tc = tzcache_get(name)) != NULL) {
+		lclptr = tc->sp;
+		if (tc->loaded) {
+			settzname();
+			return;
+		}
+	} else {
+		if (lclbuf == NULL) {
+			save_errno save;
+			lclbuf = (timezone_t) calloc(1, sizeof *lclbuf);
+		}
+		lclptr = lclbuf;
 		if (lclptr == NULL) {
 			settzname();	/* all we can do */
 			return;
@@ -1670,6 +1773,8 @@ tzset_unlocked(void)
 	} else if (tzload(lclptr, name, TRUE) != 0)
 		if (name[0] == ':' || tzparse(lclptr, name, FALSE) != 0)
 			(void) gmtload(lclptr);
+	if (tc != NULL)
+		tzcache_done(tc);
 	settzname();
 }
 
@@ -1750,15 +1855,24 @@ localsub(const timezone_t sp, const time_t * const timep, const long offset,
 				break;
 			}
 	} else {
-		int	lo = 1;
+		int	lo = sp->lasthit;
 		int	hi = sp->timecnt;
 
-		while (lo < hi) {
-			int	mid = (lo + hi) / 2;
-
-			if (t < sp->ats[mid])
-				hi = mid;
-			else	lo = mid + 1;
+		/*
+		** Successive conversions tend to fall between the same
+		** two transitions; try the last one found first.
+		*/
+		if (lo < 1 || lo > hi || t < sp->ats[lo - 1] ||
+		    (lo < hi && t >= sp->ats[lo])) {
+			lo = 1;
+			while (lo < hi) {
+				int	mid = (lo + hi) / 2;
+
+				if (t < sp->ats[mid])
+					hi = mid;
+				else	lo = mid + 1;
+			}
+			sp->lasthit = lo;
 		}
 		i = (int) sp->types[lo - 1];
 	}
@@ -5969,6 +5969,13 @@ int mspace_mallopt(int param_number, int value) {
   return change_mparam(param_number, value);
 }
 
+#if FOOTERS
+/* Cygwin: return the space that owns the in-use block mem. */
+mspace mspace_owner(void* mem) {
+  return (mspace)get_mstate_for(mem2chunk(mem));
+}
+#endif /* FOOTERS */
+
 #endif /* MSPACES */
 
 
@@ -17,6 +17,7 @@ details. */
 #include "cygmalloc.h"
 #include <malloc.h>
 extern "C" struct mallinfo dlmallinfo ();
+extern "C" struct mallinfo mspace_mallinfo (void *);
 
 /* we provide these stubs to call into a user's
    provided malloc if there is one - otherwise
@@ -27,6 +28,88 @@ extern "C" struct mallinfo dlmallinfo ();
 static bool use_internal = true;
 static bool internal_malloc_determined;
 
+/* Threads allocate from one of MSPACE_POOL mspaces, chosen by thread id
+   and each guarded by its own lock, so that threads do not serialize on
+   a single lock.  dlmalloc's global space, used before malloc_init has
+   set up the pool and if an mspace cannot be created, is guarded by
+   mallock.  A block is always freed or reallocated under the lock of
+   the space that owns it, found from its footer.
+
+   The spaces themselves are inherited by a forked child, the locks are
+   set up again by malloc_init.  */
+
+#define MSPACE_POOL 8
+
+muto NO_COPY mallock;
+static muto NO_COPY pool_lock[MSPACE_POOL];
+static void *pool_ms[MSPACE_POOL];
+static bool NO_COPY pool_ready;
+
+/* Lock the calling thread's space and return it, creating it on first
+   use.  Return NULL with mallock held if the global space is to be used.
+   SLOT is set for unlock_space.  */
+static void *
+lock_thread_space (int &slot)
+{
+  if (pool_ready)
+    {
+      /* Thread ids are multiples of 4. */
+      slot = (GetCurrentThreadId () >> 2) % MSPACE_POOL;
+      pool_lock[slot].acquire ();
+      if (pool_ms[slot] || (pool_ms[slot] = create_mspace (0, 0)))
+	return pool_ms[slot];
+      pool_lock[slot].release ();
+    }
+  slot = -1;
+  mallock.acquire ();
+  return NULL;
+}
+
+/* Lock the space owning block P and return its slot. */
+static int
+lock_owner (void *p)
+{
+  void *ms = mspace_owner (p);
+
+  for (int i = 0; i < MSPACE_POOL; i++)
+    if (pool_ms[i] == ms)
+      {
+	pool_lock[i].acquire ();
+	return i;
+      }
+  mallock.acquire ();
+  return -1;
+}
+
+static void
+unlock_space (int slot)
+{
+  if (slot < 0)
+    mallock.release ();
+  else
+    pool_lock[slot].release ();
+}
+
+/* Lock every space, for fork and for the functions affecting them all. */
+bool
+malloc_lock ()
+{
+  mallock.acquire ();
+  if (pool_ready)
+    for (int i = 0; i < MSPACE_POOL; i++)
+      pool_lock[i].acquire ();
+  return true;
+}
+
+void
+malloc_unlock ()
+{
+  if (pool_ready)
+    for (int i = MSPACE_POOL - 1; i >= 0; i--)
+      pool_lock[i].release ();
+  mallock.release ();
+}
+
 /* These routines are used by the application if it
    doesn't provide its own malloc. */
 
@@ -36,11 +119,11 @@ free (void *p)
   malloc_printf ("(%p), called by %p", p, caller_return_address ());
   if (!use_internal)
     user_data->free (p);
-  else
+  else if (p)
     {
-      __malloc_lock ();
+      int slot = lock_owner (p);
       dlfree (p);
-      __malloc_unlock ();
+      unlock_space (slot);
     }
 }
 
@@ -52,9 +135,10 @@ malloc (size_t size)
     res = user_data->malloc (size);
   else
     {
-      __malloc_lock ();
-      res = dlmalloc (size);
-      __malloc_unlock ();
+      int slot;
+      void *ms = lock_thread_space (slot);
+      res = ms ? mspace_malloc (ms, size) : dlmalloc (size);
+      unlock_space (slot);
     }
   malloc_printf ("(%ld) = %p, called by %p", size, res,
 					     caller_return_address ());
@@ -67,11 +151,14 @@ realloc (void *p, size_t size)
   void *res;
   if (!use_internal)
     res = user_data->realloc (p, size);
+  else if (!p)
+    return malloc (size);
   else
     {
-      __malloc_lock ();
+      /* dlrealloc keeps the block in its owner's space. */
+      int slot = lock_owner (p);
       res = dlrealloc (p, size);
-      __malloc_unlock ();
+      unlock_space (slot);
     }
   malloc_printf ("(%p, %ld) = %p, called by %p", p, size, res,
   						 caller_return_address ());
@@ -97,9 +184,10 @@ calloc (size_t nmemb, size_t size)
     res = user_data->calloc (nmemb, size);
   else
     {
-      __malloc_lock ();
-      res = dlcalloc (nmemb, size);
-      __malloc_unlock ();
+      int slot;
+      void *ms = lock_thread_space (slot);
+      res = ms ? mspace_calloc (ms, nmemb, size) : dlcalloc (nmemb, size);
+      unlock_space (slot);
     }
   malloc_printf ("(%ld, %ld) = %p, called by %p", nmemb, size, res,
 						  caller_return_address ());
@@ -111,14 +199,16 @@ posix_memalign (void **memptr, size_t alignment, size_t bytes)
 {
   save_errno save;
 
-  void *res;
+  void *res, *ms;
+  int slot;
   if (!use_internal)
     return user_data->posix_memalign (memptr, alignment, bytes);
   if ((alignment & (alignment - 1)) != 0)
     return EINVAL;
-  __malloc_lock ();
-  res = dlmemalign (alignment, bytes);
-  __malloc_unlock ();
+  ms = lock_thread_space (slot);
+  res = ms ? mspace_memalign (ms, alignment, bytes)
+	   : dlmemalign (alignment, bytes);
+  unlock_space (slot);
   if (!res)
     return ENOMEM;
   *memptr = res;
@@ -136,9 +226,11 @@ memalign (size_t alignment, size_t bytes)
     }
   else
     {
-      __malloc_lock ();
-      res = dlmemalign (alignment, bytes);
-      __malloc_unlock ();
+      int slot;
+      void *ms = lock_thread_space (slot);
+      res = ms ? mspace_memalign (ms, alignment, bytes)
+	       : dlmemalign (alignment, bytes);
+      unlock_space (slot);
     }
 
   return res;
@@ -155,9 +247,9 @@ valloc (size_t bytes)
     }
   else
     {
-      __malloc_lock ();
+      mallock.acquire ();
       res = dlvalloc (bytes);
-      __malloc_unlock ();
+      mallock.release ();
     }
 
   return res;
@@ -172,11 +264,13 @@ malloc_usable_size (void *p)
       set_errno (ENOSYS);
       res = 0;
     }
+  else if (!p)
+    res = 0;
   else
     {
-      __malloc_lock ();
+      int slot = lock_owner (p);
       res = dlmalloc_usable_size (p);
-      __malloc_unlock ();
+      unlock_space (slot);
     }
 
   return res;
@@ -193,9 +287,12 @@ malloc_trim (size_t pad)
     }
   else
     {
-      __malloc_lock ();
+      malloc_lock ();
       res = dlmalloc_trim (pad);
-      __malloc_unlock ();
+      for (int i = 0; i < MSPACE_POOL; i++)
+	if (pool_ms[i])
+	  res |= mspace_trim (pool_ms[i], pad);
+      malloc_unlock ();
     }
 
   return res;
@@ -212,9 +309,9 @@ mallopt (int p, int v)
     }
   else
     {
-      __malloc_lock ();
+      malloc_lock ();
       res = dlmallopt (p, v);
-      __malloc_unlock ();
+      malloc_unlock ();
     }
 
   return res;
@@ -227,9 +324,12 @@ malloc_stats ()
     set_errno (ENOSYS);
   else
     {
-      __malloc_lock ();
+      malloc_lock ();
       dlmalloc_stats ();
-      __malloc_unlock ();
+      for (int i = 0; i < MSPACE_POOL; i++)
+	if (pool_ms[i])
+	  mspace_malloc_stats (pool_ms[i]);
+      malloc_unlock ();
     }
 }
 
@@ -244,9 +344,22 @@ mallinfo ()
     }
   else
     {
-      __malloc_lock ();
+      malloc_lock ();
       m = dlmallinfo ();
-      __malloc_unlock ();
+      for (int i = 0; i < MSPACE_POOL; i++)
+	if (pool_ms[i])
+	  {
+	    struct mallinfo ms = mspace_mallinfo (pool_ms[i]);
+	    m.arena += ms.arena;
+	    m.ordblks += ms.ordblks;
+	    m.hblks += ms.hblks;
+	    m.hblkhd += ms.hblkhd;
+	    m.usmblks += ms.usmblks;
+	    m.uordblks += ms.uordblks;
+	    m.fordblks += ms.fordblks;
+	    m.keepcost += ms.keepcost;
+	  }
+      malloc_unlock ();
     }
 
   return m;
@@ -262,19 +375,18 @@ strdup (const char *s)
   return p;
 }
 
-/* We use a critical section to lock access to the malloc data
-   structures.  This permits malloc to be called from different
-   threads.  Note that it does not make malloc reentrant, and it does
-   not permit a signal handler to call malloc.  The malloc code in
-   newlib will call __malloc_lock and __malloc_unlock at appropriate
-   times.  */
-
-muto NO_COPY mallock;
+/* We use mutos to lock access to the malloc data structures.  This
+   permits malloc to be called from different threads.  Note that it
+   does not make malloc reentrant, and it does not permit a signal
+   handler to call malloc.  */
 
 void
 malloc_init ()
 {
   mallock.init ("mallock");
+  for (int i = 0; i < MSPACE_POOL; i++)
+    pool_lock[i].init ("mspace_lock");
+  pool_ready = true;
 
   /* Check if malloc is provided by application. If so, redirect all
      calls to malloc/free/realloc to application provided. This may
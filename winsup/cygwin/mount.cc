@@ -679,35 +679,40 @@ mount_info::conv_to_win32_path (const char *src_path, char *dst, device& dev,
 
   int chroot_pathlen;
   chroot_pathlen = 0;
-  /* Check the mount table for prefix matches. */
-  for (i = 0; i < nmounts; i++)
-    {
-      const char *path;
-      int len;
+  /* Check the mount table for prefix matches.  Outside a chroot this is
+     a lookup in the POSIX index, inside one the mount points have to be
+     translated first, so scan them all. */
+  if (!cygheap->root.exists ())
+    mi = find_mount (src_path, false);
+  else
+    for (i = 0, mi = NULL; i < nmounts; i++)
+      {
+	const char *path;
+	int len;
 
-      mi = mount + posix_sorted[i];
-      if (!cygheap->root.exists ()
-	  || (mi->posix_pathlen == 1 && mi->posix_path[0] == '/'))
-	{
-	  path = mi->posix_path;
-	  len = mi->posix_pathlen;
-	}
-      else if (cygheap->root.posix_ok (mi->posix_path))
-	{
-	  path = cygheap->root.unchroot (mi->posix_path);
-	  chroot_pathlen = len = strlen (path);
-	}
-      else
-	{
-	  chroot_pathlen = 0;
-	  continue;
-	}
+	mi = mount + posix_sorted[i];
+	if (mi->posix_pathlen == 1 && mi->posix_path[0] == '/')
+	  {
+	    path = mi->posix_path;
+	    len = mi->posix_pathlen;
+	  }
+	else if (cygheap->root.posix_ok (mi->posix_path))
+	  {
+	    path = cygheap->root.unchroot (mi->posix_path);
+	    chroot_pathlen = len = strlen (path);
+	  }
+	else
+	  {
+	    chroot_pathlen = 0;
+	    continue;
+	  }
 
-      if (path_prefix_p (path, src_path, len, mi->flags & MOUNT_NOPOSIX))
-	break;
-    }
+	if (path_prefix_p (path, src_path, len, mi->flags & MOUNT_NOPOSIX))
+	  break;
+	mi = NULL;
+      }
 
-  if (i < nmounts)
+  if (mi)
     {
       int err = mi->build_win32 (dst, src_path, flags, chroot_pathlen);
       if (err)
@@ -914,15 +919,25 @@ mount_info::conv_to_posix_path (const char *src_path, char *posix_path,
     }
 
   int pathbuflen = tail - pathbuf;
-  for (int i = 0; i < nmounts; ++i)
-    {
-      mount_item &mi = mount[native_sorted[i]];
-      if (!path_prefix_p (mi.native_path, pathbuf, mi.native_pathlen,
-			  mi.flags & MOUNT_NOPOSIX))
-	continue;
+  mount_item *found = NULL;
+  if (!cygheap->root.exists ())
+    found = find_mount (pathbuf, true);
+  else
+    for (int i = 0; i < nmounts; ++i)
+      {
+	mount_item &mi = mount[native_sorted[i]];
+	if (path_prefix_p (mi.native_path, pathbuf, mi.native_pathlen,
+			   mi.flags & MOUNT_NOPOSIX)
+	    && cygheap->root.posix_ok (mi.posix_path))
+	  {
+	    found = &mi;
+	    break;
+	  }
+      }
 
-      if (cygheap->root.exists () && !cygheap->root.posix_ok (mi.posix_path))
-	continue;
+  if (found)
+    {
+      mount_item &mi = *found;
 
       /* SRC_PATH is in the mount table. */
       int nextchar;
@@ -996,14 +1011,8 @@ out:
 unsigned
 mount_info::set_flags_from_win32_path (const char *p)
 {
-  for (int i = 0; i < nmounts; i++)
-    {
-      mount_item &mi = mount[native_sorted[i]];
-      if (path_prefix_p (mi.native_path, p, mi.native_pathlen,
-			 mi.flags & MOUNT_NOPOSIX))
-	return mi.flags;
-    }
-  return PATH_BINARY;
+  mount_item *mi = find_mount (p, true);
+  return mi ? mi->flags : PATH_BINARY;
 }
 
 inline char *
@@ -1374,6 +1383,44 @@ sort_by_native_name (const void *a, const void *b)
   return res;
 }
 
+/* The mount point indices hash paths in a way that is blind to case,
+   since mounts may be case-insensitive.  Only ASCII letters are folded,
+   other bytes of a multibyte character count by their position, so two
+   spellings of a path differing in case get the same key as long as they
+   have the same length in bytes, which is what path_prefix_p compares. */
+#define MOUNT_HASH_INIT 2166136261U
+
+static inline uint32_t
+mount_hash_step (uint32_t key, char c)
+{
+  unsigned char uc = c;
+
+  if (uc >= 0x80)
+    uc = 0x80;
+  else if (uc >= 'A' && uc <= 'Z')
+    uc += 'a' - 'A';
+  return (key ^ uc) * 16777619U;
+}
+
+static void
+mount_hash_add (mount_hash_ent *tab, const char *path, int len, int idx)
+{
+  uint32_t key = MOUNT_HASH_INIT;
+
+  /* Match path_prefix_p, which ignores one trailing separator. */
+  if (len > 0 && isdirsep (path[len - 1]))
+    len--;
+  for (int i = 0; i < len; i++)
+    key = mount_hash_step (key, path[i]);
+
+  int slot = key & (MOUNT_HASH_SIZE - 1);
+  while (tab[slot].idx)
+    slot = (slot + 1) & (MOUNT_HASH_SIZE - 1);
+  tab[slot].key = key;
+  tab[slot].len = len;
+  tab[slot].idx = idx + 1;
+}
+
 void
 mount_info::sort ()
 {
@@ -1384,6 +1431,56 @@ mount_info::sort ()
   mounts_for_sort = mount;	/* ouch. */
   qsort (posix_sorted, nmounts, sizeof (posix_sorted[0]), sort_by_posix_name);
   qsort (native_sorted, nmounts, sizeof (native_sorted[0]), sort_by_native_name);
+
+  /* Index the mount points for find_mount.  Inserting them in sorted
+     order keeps entries for the same path in the order of preference. */
+  memset (posix_hash, 0, sizeof posix_hash);
+  memset (native_hash, 0, sizeof native_hash);
+  for (int i = 0; i < nmounts; i++)
+    {
+      mount_item *mi = mount + posix_sorted[i];
+      mount_hash_add (posix_hash, mi->posix_path, mi->posix_pathlen,
+		      posix_sorted[i]);
+      mi = mount + native_sorted[i];
+      mount_hash_add (native_hash, mi->native_path, mi->native_pathlen,
+		      native_sorted[i]);
+    }
+}
+
+/* find_mount: Return the mount point which is the longest prefix of PATH,
+   the first match in posix_sorted resp. native_sorted order.  A mount
+   point can only match a prefix of PATH ending at a directory separator,
+   the end of PATH, or just after a colon, so look up each such prefix in
+   the index while hashing PATH once.  The cost depends on the length of
+   PATH rather than on the number of mounts. */
+mount_item *
+mount_info::find_mount (const char *path, bool native)
+{
+  mount_hash_ent *tab = native ? native_hash : posix_hash;
+  mount_item *found = NULL;
+  uint32_t key = MOUNT_HASH_INIT;
+
+  for (const char *p = path; ; key = mount_hash_step (key, *p++))
+    {
+      if (isdirsep (*p) || !*p || (p > path && p[-1] == ':'))
+	for (int slot = key & (MOUNT_HASH_SIZE - 1); tab[slot].idx;
+	     slot = (slot + 1) & (MOUNT_HASH_SIZE - 1))
+	  {
+	    if (tab[slot].key != key || tab[slot].len != p - path)
+	      continue;
+	    mount_item *mi = mount + tab[slot].idx - 1;
+	    if (path_prefix_p (native ? mi->native_path : mi->posix_path, path,
+			       native ? mi->native_pathlen : mi->posix_pathlen,
+			       mi->flags & MOUNT_NOPOSIX))
+	      {
+		found = mi;
+		break;
+	      }
+	  }
+      if (!*p)
+	break;
+    }
+  return found;
 }
 
 /* Add an entry to the mount table.
@@ -156,6 +156,16 @@ class mount_item
    scheme should be satisfactory for a long while yet.  */
 #define MAX_MOUNTS 64
 
+/* Slot in the hash indices of mount points kept by mount_info::sort.  */
+#define MOUNT_HASH_SIZE (2 * MAX_MOUNTS)
+
+struct mount_hash_ent
+{
+  uint32_t key;		/* hash of the mount point, see mount_hash_step */
+  short len;		/* its length without a trailing slash */
+  short idx;		/* index into mount_info::mount + 1, 0 if unused */
+};
+
 class reg_key;
 struct device;
 
@@ -181,6 +191,8 @@ class mount_info
  private:
   int posix_sorted[MAX_MOUNTS];
   int native_sorted[MAX_MOUNTS];
+  mount_hash_ent posix_hash[MOUNT_HASH_SIZE];
+  mount_hash_ent native_hash[MOUNT_HASH_SIZE];
 
  public:
   void init (bool);
@@ -205,6 +217,7 @@ class mount_info
 
  private:
   void sort ();
+  mount_item *find_mount (const char *path, bool native);
   void mount_slash ();
   void create_root_entry (const PWCHAR root);
 
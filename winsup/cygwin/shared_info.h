@@ -13,7 +13,7 @@ details. */
 #include "mount.h"
 #include "loadavg.h"
 
-#define CURR_USER_MAGIC 0xab1fcce8U
+#define CURR_USER_MAGIC 0x3c9e5a71U
 
 class user_info
 {
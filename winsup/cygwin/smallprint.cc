@@ -8,7 +8,6 @@ details. */
 
 #include "winsup.h"
 #include "ntdll.h"
-#include "sync.h"
 #include <stdlib.h>
 #include <ctype.h>
 #include <wchar.h>
@@ -53,42 +52,79 @@ details. */
 
 static const char hex_str_upper[] = "0123456789ABCDEF";
 static const char hex_str_lower[] = "0123456789abcdef";
-
-class tmpbuf
+static const char dec_pairs[] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+/* Longest number is ULLONG_MAX in octal, 1777777777777777777777, 22 digits */
+#define MAX_DIGITS 22
+
+/* Write the digits of UVAL in BASE so that they end just before END and
+   return a pointer to the first one.  Hex and octal digits are shifted
+   out, decimal ones are taken from dec_pairs two at a time, and only as
+   long as the value needs 64 bits is the arithmetic done in 64 bits. */
+static char __fastcall *
+__rdigits (char *end, int base, unsigned long long uval, const char *hex_str)
 {
-  static WCHAR buf[NT_MAX_PATH];
-  static muto lock;
-  bool locked;
-public:
-  operator WCHAR * ()
-  {
-    if (!locked)
+  char *p = end;
+
+  if (base == 16)
+    do
       {
-	lock.init ("smallprint_buf")->acquire ();
-	locked = true;
+	*--p = hex_str[uval & 0xf];
+	uval >>= 4;
       }
-    return buf;
-  }
-  operator char * () {return (char *) ((WCHAR *) *this);}
-
-  tmpbuf (): locked (false) {};
-  ~tmpbuf ()
-  {
-    if (locked)
-      lock.release ();
-  }
-};
+    while (uval);
+  else if (base == 8)
+    do
+      {
+	*--p = '0' + (uval & 7);
+	uval >>= 3;
+      }
+    while (uval);
+  else
+    {
+      unsigned int r;
 
-WCHAR tmpbuf::buf[NT_MAX_PATH];
-muto tmpbuf::lock;
+      while (uval > 0xffffffffULL)
+	{
+	  r = uval % 100;
+	  uval /= 100;
+	  p -= 2;
+	  p[0] = dec_pairs[2 * r];
+	  p[1] = dec_pairs[2 * r + 1];
+	}
+      unsigned int v = uval;
+      while (v >= 100)
+	{
+	  r = v % 100;
+	  v /= 100;
+	  p -= 2;
+	  p[0] = dec_pairs[2 * r];
+	  p[1] = dec_pairs[2 * r + 1];
+	}
+      if (v >= 10)
+	{
+	  p -= 2;
+	  p[0] = dec_pairs[2 * v];
+	  p[1] = dec_pairs[2 * v + 1];
+	}
+      else
+	*--p = '0' + v;
+    }
+  return p;
+}
 
 static char __fastcall *
 __rn (char *dst, int base, int dosign, long long val, int len, int pad, unsigned long long mask)
 {
-  /* longest number is ULLONG_MAX, 18446744073709551615, 20 digits */
   unsigned long long uval = 0;
-  char res[20];
-  int l = 0;
+  char res[MAX_DIGITS];
+  char *p;
+  int l;
   const char *hex_str;
 
   if (base < 0)
@@ -114,26 +150,19 @@ __rn (char *dst, int base, int dosign, long long val, int len, int pad, unsigned
 
   uval &= mask;
 
-  do
-    {
-      res[l++] = hex_str[uval % base];
-      uval /= base;
-    }
-  while (uval);
+  p = __rdigits (res + MAX_DIGITS, base, uval, hex_str);
+  l = res + MAX_DIGITS - p;
 
   while (len-- > l)
     *dst++ = pad;
 
-  while (l > 0)
-    *dst++ = res[--l];
-
-  return dst;
+  memcpy (dst, p, l);
+  return dst + l;
 }
 
 int
 __small_vsprintf (char *dst, const char *fmt, va_list ap)
 {
-  tmpbuf tmp;
   char *orig = dst;
   const char *s;
   PWCHAR w;
@@ -347,12 +376,13 @@ gen_decimalLL:
 			    *dst++ = w;
 			}
 		    }
-		  else if (sys_wcstombs (tmp, NT_MAX_PATH, us->Buffer,
-				    us->Length / sizeof (WCHAR)))
-		    {
-		      s = tmp;
-		      goto fillin;
-		    }
+		  else
+		    /* Convert straight into the output, where the result
+		       would end up anyway.  Limiting the length to the
+		       precision keeps it from writing beyond that. */
+		    dst += sys_wcstombs (dst, n < 0x7fff ? n + 1 : NT_MAX_PATH,
+					 us->Buffer,
+					 us->Length / sizeof (WCHAR));
 		  break;
 		default:
 		  *dst++ = '?';
@@ -442,10 +472,10 @@ console_printf (const char *fmt, ...)
 static PWCHAR __fastcall
 __wrn (PWCHAR dst, int base, int dosign, long long val, int len, int pad, unsigned long long mask)
 {
-  /* longest number is ULLONG_MAX, 18446744073709551615, 20 digits */
   unsigned long long uval = 0;
-  WCHAR res[20];
-  int l = 0;
+  char res[MAX_DIGITS];
+  char *p;
+  int l;
   const char *hex_str;
 
   if (base < 0)
@@ -471,18 +501,14 @@ __wrn (PWCHAR dst, int base, int dosign, long long val, int len, int pad, unsign
 
   uval &= mask;
 
-  do
-    {
-      res[l++] = hex_str[uval % base];
-      uval /= base;
-    }
-  while (uval);
+  p = __rdigits (res + MAX_DIGITS, base, uval, hex_str);
+  l = res + MAX_DIGITS - p;
 
   while (len-- > l)
     *dst++ = pad;
 
-  while (l > 0)
-    *dst++ = res[--l];
+  while (p < res + MAX_DIGITS)
+    *dst++ = *p++;
 
   return dst;
 }
@@ -490,7 +516,6 @@ __wrn (PWCHAR dst, int base, int dosign, long long val, int len, int pad, unsign
 int
 __small_vswprintf (PWCHAR dst, const WCHAR *fmt, va_list ap)
 {
-  tmpbuf tmp;
   PWCHAR orig = dst;
   const char *s;
   PWCHAR w;
@@ -648,9 +673,14 @@ gen_decimalLL:
 		  s = va_arg (ap, char *);
 		  if (s == NULL)
 		    s = "(null)";
-		  sys_mbstowcs (tmp, NT_MAX_PATH, s, n < 0x7fff ? (int) n : -1);
-		  RtlInitUnicodeString (us = &uw, tmp);
-		  goto fillin;
+		  /* As in __small_vsprintf, convert straight into the
+		     output.  sys_mbstowcs counts the trailing NUL if it
+		     gets that far, so don't step over it. */
+		  len = sys_mbstowcs (dst, n < 0x7fff ? n + 1 : NT_MAX_PATH,
+				      s, n < 0x7fff ? (int) n : -1);
+		  if (len && !dst[len - 1])
+		    len--;
+		  dst += len;
 		  break;
 		case L'W':
 		  w = va_arg (ap, PWCHAR);
@@ -0,0 +1,223 @@
+/* mspace-pool.cc: test the mspace pool in malloc_wrapper.cc on the host.
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#include "winsup.h"
+#include "cygmalloc.h"
+#include <malloc.h>
+#include <stdio.h>
+#include <sys/mman.h>
+
+extern "C" struct mallinfo mspace_mallinfo (void *);
+
+#define CHECK(a) \
+  do \
+    if (!(a)) \
+      { \
+	printf ("Failed " #a " at line %d\n", __LINE__); \
+	abort (); \
+      } \
+  while (0)
+
+static per_process the_user_data = { malloc, free, realloc, calloc,
+				      posix_memalign };
+per_process *user_data = &the_user_data;
+
+/* malloc.cc gets its memory here.  */
+static volatile bool fail_mmap;
+
+extern "C" void *
+test_mmap64 (void *addr, size_t len, int prot, int flags, int fd, off_t off)
+{
+  if (fail_mmap)
+    return MAP_FAILED;
+  return mmap (addr, len, prot, flags, fd, off);
+}
+
+static void *
+run (void *(*func) (void *), void *arg)
+{
+  pthread_t t;
+  void *res;
+
+  CHECK (pthread_create (&t, NULL, func, arg) == 0);
+  CHECK (pthread_join (t, &res) == 0);
+  return res;
+}
+
+static size_t
+in_use (void *ms)
+{
+  return mspace_mallinfo (ms).uordblks;
+}
+
+/* A thread that cannot create its space allocates from the global one,
+   and gets a space of its own once creating one works again.  */
+static void
+test_fallback (void *global)
+{
+  void *p, *q;
+
+  fail_mmap = true;
+  p = malloc (32);
+  q = calloc (4, 8);
+  fail_mmap = false;
+  CHECK (p && q);
+  CHECK (mspace_owner (p) == global);
+  CHECK (mspace_owner (q) == global);
+  free (p);
+  free (q);
+
+  p = malloc (32);
+  CHECK (p);
+  CHECK (mspace_owner (p) != global);
+  free (p);
+}
+
+#define NBLOCKS 1000
+
+struct blocks
+{
+  void *ms;
+  void *p[NBLOCKS];
+};
+
+static void *
+alloc_blocks (void *arg)
+{
+  blocks *b = (blocks *) arg;
+
+  for (int i = 0; i < NBLOCKS; i++)
+    {
+      CHECK ((b->p[i] = malloc (64)));
+      memset (b->p[i], i, 64);
+    }
+  b->ms = mspace_owner (b->p[0]);
+  return NULL;
+}
+
+/* Allocate blocks in a thread whose space is not MINE.  */
+static void
+alloc_elsewhere (blocks *b, void *mine)
+{
+  for (int tries = 0; ; tries++)
+    {
+      CHECK (tries < 64);
+      run (alloc_blocks, b);
+      if (b->ms != mine)
+	break;
+      for (int i = 0; i < NBLOCKS; i++)
+	free (b->p[i]);
+    }
+}
+
+/* Blocks freed and reallocated by this thread go back to the space of
+   the thread that allocated them.  */
+static void
+test_cross_thread (void *global)
+{
+  void *p, *mine;
+  size_t before, mine_before;
+  blocks b;
+
+  CHECK ((p = malloc (16)));
+  mine = mspace_owner (p);
+  free (p);
+
+  alloc_elsewhere (&b, mine);
+  CHECK (b.ms != global);
+  for (int i = 0; i < NBLOCKS; i++)
+    CHECK (mspace_owner (b.p[i]) == b.ms);
+
+  before = in_use (b.ms);
+  mine_before = in_use (mine);
+  for (int i = 0; i < NBLOCKS / 2; i++)
+    free (b.p[i]);
+  CHECK (in_use (b.ms) <= before - NBLOCKS / 2 * 64);
+  CHECK (in_use (mine) == mine_before);
+
+  for (int i = NBLOCKS / 2; i < NBLOCKS; i++)
+    {
+      void *q = realloc (b.p[i], i % 2 ? 4096 : 16);
+
+      CHECK (q);
+      CHECK (mspace_owner (q) == b.ms);
+      for (int j = 0; j < 16; j++)
+	CHECK (((unsigned char *) q)[j] == (unsigned char) i);
+      b.p[i] = q;
+    }
+  CHECK (in_use (mine) == mine_before);
+
+  for (int i = NBLOCKS / 2; i < NBLOCKS; i++)
+    free (b.p[i]);
+  CHECK (in_use (b.ms) < before - (NBLOCKS - 1) * 64);
+}
+
+/* Threads hand blocks to each other to free and reallocate.  A block
+   handled under the wrong lock shows up as a corrupted space.  */
+
+#define NTHREADS 8
+#define NSLOTS 32
+#define ROUNDS 100000
+
+static void *slot[NSLOTS];
+static pthread_mutex_t slot_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void *
+churn (void *arg)
+{
+  unsigned int seed = (unsigned int) (size_t) arg;
+
+  for (int i = 0; i < ROUNDS; i++)
+    {
+      int n = rand_r (&seed) % NSLOTS;
+      size_t size = 8 + rand_r (&seed) % 512;
+      void *p = malloc (size), *old;
+
+      CHECK (p);
+      memset (p, n, size);
+      pthread_mutex_lock (&slot_lock);
+      old = slot[n];
+      slot[n] = p;
+      pthread_mutex_unlock (&slot_lock);
+      if (old && (i & 1))
+	old = realloc (old, size * 2);
+      free (old);
+    }
+  return NULL;
+}
+
+static void
+test_churn ()
+{
+  pthread_t t[NTHREADS];
+
+  for (size_t i = 0; i < NTHREADS; i++)
+    CHECK (pthread_create (&t[i], NULL, churn, (void *) (i + 1)) == 0);
+  for (int i = 0; i < NTHREADS; i++)
+    CHECK (pthread_join (t[i], NULL) == 0);
+  for (int i = 0; i < NSLOTS; i++)
+    free (slot[i]);
+}
+
+int
+main ()
+{
+  void *p, *global;
+
+  /* Before malloc_init every block comes from the global space.  */
+  CHECK ((p = malloc (16)));
+  global = mspace_owner (p);
+  free (p);
+
+  malloc_init ();
+  test_fallback (global);
+  test_cross_thread (global);
+  test_churn ();
+  malloc_trim (0);
+  return 0;
+}
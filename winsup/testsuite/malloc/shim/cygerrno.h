@@ -0,0 +1 @@
+/* cygerrno.h: nothing of it is needed by malloc_wrapper.cc on the host.  */
@@ -0,0 +1 @@
+/* dtable.h: nothing of it is needed by malloc_wrapper.cc on the host.  */
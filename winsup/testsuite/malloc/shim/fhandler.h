@@ -0,0 +1 @@
+/* fhandler.h: nothing of it is needed by malloc_wrapper.cc on the host.  */
@@ -0,0 +1,12 @@
+/* host-malloc.h: included ahead of malloc.cc on the host.  The system's
+   mmap64 is declared first, under its own name, and malloc.cc's calls
+   then go to test_mmap64 in the test program.
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#include <sys/mman.h>
+#define mmap64 test_mmap64
@@ -0,0 +1 @@
+/* path.h: nothing of it is needed by malloc_wrapper.cc on the host.  */
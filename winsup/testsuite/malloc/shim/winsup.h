@@ -0,0 +1,65 @@
+/* winsup.h: just enough of the Cygwin DLL for malloc_wrapper.cc to be
+   built and run on a Linux host.
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#pragma once
+
+#define __INSIDE_CYGWIN__
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#define NO_COPY
+#define INFINITE 0xffffffff
+typedef unsigned int DWORD;
+
+/* Like Cygwin's muto, recursive.  */
+class muto
+{
+  pthread_mutex_t mutex;
+public:
+  muto () { mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP; }
+  void init (const char *) {}
+  int acquire (DWORD = INFINITE) { return !pthread_mutex_lock (&mutex); }
+  void release () { pthread_mutex_unlock (&mutex); }
+};
+
+/* Windows thread ids are multiples of 4.  */
+static inline DWORD
+GetCurrentThreadId ()
+{
+  return (DWORD) syscall (SYS_gettid) << 2;
+}
+
+#define malloc_printf(fmt, ...)
+#define caller_return_address() NULL
+#define set_errno(e) (errno = (e))
+
+struct save_errno
+{
+  int saved;
+  save_errno () { saved = errno; }
+  ~save_errno () { errno = saved; }
+};
+
+struct per_process
+{
+  void *(*malloc) (size_t);
+  void (*free) (void *);
+  void *(*realloc) (void *, size_t);
+  void *(*calloc) (size_t, size_t);
+  int (*posix_memalign) (void **, size_t, size_t);
+};
+extern per_process *user_data;
+template <typename T> static inline void *import_address (T) { return NULL; }
+
+void malloc_init ();
@@ -0,0 +1 @@
+/* ntdll.h: nothing of it is needed by smallprint.cc on the host.  */
@@ -0,0 +1,68 @@
+/* winsup.h: just enough of the Cygwin DLL for smallprint.cc to be built
+   and run on a Linux host.
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#pragma once
+
+#define __INSIDE_CYGWIN__
+
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <wchar.h>
+
+#define NO_COPY
+#define __fastcall
+#define NT_MAX_PATH 32768
+
+typedef unsigned int DWORD;
+typedef unsigned short USHORT;
+typedef wchar_t WCHAR, *PWCHAR;
+typedef void *HANDLE;
+
+typedef struct
+{
+  USHORT Length;
+  USHORT MaximumLength;
+  PWCHAR Buffer;
+} UNICODE_STRING, *PUNICODE_STRING;
+
+extern DWORD last_error;
+static inline DWORD GetLastError () { return last_error; }
+static inline void SetLastError (DWORD e) { last_error = e; }
+static inline int get_errno () { return errno; }
+
+extern WCHAR global_progname[];
+
+static inline void
+RtlInitUnicodeString (PUNICODE_STRING us, const WCHAR *s)
+{
+  us->Buffer = (PWCHAR) s;
+  us->Length = wcslen (s) * sizeof (WCHAR);
+  us->MaximumLength = us->Length + sizeof (WCHAR);
+}
+
+/* Both follow strfuncs.cc: the result counts the characters written,
+   and sys_mbstowcs counts the trailing NUL as well once it reaches it.  */
+size_t sys_wcstombs (char *, size_t, const wchar_t *, size_t = (size_t) -1);
+size_t sys_mbstowcs (wchar_t *, size_t, const char *, size_t = (size_t) -1);
+
+#define STD_ERROR_HANDLE ((DWORD) -12)
+static inline HANDLE GetStdHandle (DWORD) { return NULL; }
+static inline int FlushFileBuffers (HANDLE) { return 1; }
+
+static inline int
+WriteFile (HANDLE, const void *buf, DWORD len, DWORD *done, void *)
+{
+  *done = write (2, buf, len);
+  return 1;
+}
@@ -0,0 +1,169 @@
+/* wide-s.cc: test %s in __small_swprintf on the host.
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#include "winsup.h"
+#include <locale.h>
+#include <stdio.h>
+
+extern int __small_swprintf (PWCHAR, const WCHAR *, ...);
+extern int __small_sprintf (char *, const char *, ...);
+
+#define CHECK(a) \
+  do \
+    if (!(a)) \
+      { \
+	printf ("Failed " #a " at line %d\n", __LINE__); \
+	abort (); \
+      } \
+  while (0)
+
+DWORD last_error;
+WCHAR global_progname[] = L"prog";
+
+/* The loops of sys_wcstombs and sys_cp_mbstowcs in strfuncs.cc, with the
+   host's conversions in place of the Cygwin charset functions.  */
+size_t
+sys_wcstombs (char *dst, size_t len, const wchar_t *src, size_t nwc)
+{
+  char buf[MB_LEN_MAX];
+  char *ptr = dst;
+  size_t n = 0;
+  mbstate_t ps;
+
+  memset (&ps, 0, sizeof ps);
+  if (dst == NULL)
+    len = (size_t) -1;
+  while (n < len && nwc-- > 0)
+    {
+      size_t bytes = wcrtomb (buf, *src, &ps);
+      if (bytes == (size_t) -1)
+	{
+	  ++src;
+	  memset (&ps, 0, sizeof ps);
+	  continue;
+	}
+      if (n + bytes > len)
+	break;
+      if (dst)
+	for (size_t i = 0; i < bytes; ++i)
+	  *ptr++ = buf[i];
+      if (*src++ == 0)
+	break;
+      n += bytes;
+    }
+  if (n && dst && len != (size_t) -1)
+    {
+      n = (n < len) ? n : len - 1;
+      dst[n] = '\0';
+    }
+  return n;
+}
+
+size_t
+sys_mbstowcs (wchar_t *dst, size_t dlen, const char *src, size_t nms)
+{
+  wchar_t *ptr = dst;
+  size_t count = 0;
+  size_t len = dlen;
+  mbstate_t ps;
+
+  memset (&ps, 0, sizeof ps);
+  if (dst == NULL)
+    len = (size_t) -1;
+  while (len > 0 && nms > 0)
+    {
+      size_t bytes = mbrtowc (ptr, src, nms, &ps);
+      if (bytes == (size_t) -1 || bytes == (size_t) -2)
+	{
+	  bytes = 1;
+	  if (dst)
+	    *ptr = L'\xf000' | (unsigned char) *src;
+	  memset (&ps, 0, sizeof ps);
+	}
+      if (bytes == 0)
+	{
+	  ++count;
+	  break;
+	}
+      src += bytes;
+      nms -= bytes;
+      ++count;
+      ptr = dst ? ptr + 1 : NULL;
+      --len;
+    }
+  if (count && dst)
+    {
+      count = (count < dlen) ? count : dlen - 1;
+      dst[count] = L'\0';
+    }
+  return count;
+}
+
+/* Fill the output with garbage first, so that a missing or stray NUL
+   shows up.  */
+#define WFMT(buf, ...) \
+  (wmemset ((buf), L'#', sizeof (buf) / sizeof (WCHAR)), \
+   __small_swprintf ((buf), __VA_ARGS__))
+
+int
+main ()
+{
+  WCHAR buf[256];
+  WCHAR name[] = L"sess";
+  UNICODE_STRING us;
+  int ret;
+
+  CHECK (setlocale (LC_CTYPE, "C.UTF-8"));
+
+  /* One %s.  */
+  ret = WFMT (buf, L"%s", "abc");
+  CHECK (ret == 3);
+  CHECK (!wcscmp (buf, L"abc"));
+
+  /* Several in one format, as shared.cc builds its object names.  */
+  RtlInitUnicodeString (&us, name);
+  ret = WFMT (buf, L"\\BaseNamedObjects\\%s%s-%S", "cygwin1", "S5", &us);
+  CHECK (ret == (int) wcslen (L"\\BaseNamedObjects\\cygwin1S5-sess"));
+  CHECK (!wcscmp (buf, L"\\BaseNamedObjects\\cygwin1S5-sess"));
+
+  ret = WFMT (buf, L"%s%s%s|%d", "a", "", "bc", 42);
+  CHECK (ret == 6);
+  CHECK (!wcscmp (buf, L"abc|42"));
+
+  /* Empty and NULL strings.  */
+  ret = WFMT (buf, L"<%s>", "");
+  CHECK (ret == 2);
+  CHECK (!wcscmp (buf, L"<>"));
+  ret = WFMT (buf, L"<%s>", (char *) NULL);
+  CHECK (ret == 8);
+  CHECK (!wcscmp (buf, L"<(null)>"));
+
+  /* Multibyte input gives one WCHAR per character.  */
+  ret = WFMT (buf, L"%s/%s", "h\xc3\xa9", "\xe4\xb8\x96x");
+  CHECK (ret == 5);
+  CHECK (!wcscmp (buf, L"h\x00e9/\x4e16x"));
+
+  /* A precision stops the conversion before the NUL, both within and
+     beyond the end of the string.  */
+  ret = WFMT (buf, L"%.2s|%.3s|%.9s", "abcdef", "abc", "xy");
+  CHECK (ret == 9);
+  CHECK (!wcscmp (buf, L"ab|abc|xy"));
+
+  /* The narrow side for comparison: %S converts without the NUL.  */
+  {
+    char nbuf[256];
+
+    memset (nbuf, '#', sizeof nbuf);
+    ret = __small_sprintf (nbuf, "%S-%S", &us, &us);
+    CHECK (ret == 9);
+    CHECK (!strcmp (nbuf, "sess-sess"));
+  }
+
+  puts ("PASS");
+  return 0;
+}
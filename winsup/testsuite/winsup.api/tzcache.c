@@ -0,0 +1,121 @@
+/* Switching TZ back and forth must give the same results as loading each
+   zone for the first time, whether the zone comes from tzset's cache or,
+   once more zones than the cache holds have been used, is loaded again.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NTIMES 200
+
+/* More than the four zones tzset caches, plus TZ values that name no
+   file.  NULL unsets TZ.  */
+static const char *zones[] = {
+  "America/New_York", "Europe/Berlin", "Australia/Lord_Howe",
+  "Asia/Tokyo", "America/Sao_Paulo", "UTC", "EST5EDT",
+  "XST-3:30XDT,M3.5.0,M10.5.0/3", "", NULL
+};
+#define NZONES (sizeof zones / sizeof *zones)
+
+struct snapshot
+{
+  char tzname[2][16];
+  long timezone;
+  int daylight;
+  struct tm tm[NTIMES];
+  time_t mk[NTIMES];
+};
+
+static struct snapshot cold[NZONES];
+
+static time_t
+sample (int i)
+{
+  /* Every 127 days or so from 1970 to 2038, at varying times of day.  */
+  return (time_t) i * (127 * 86400L + 3607) - 86400L * 7 * (i % 3);
+}
+
+static void
+set_zone (int z)
+{
+  if (zones[z] == NULL)
+    unsetenv ("TZ");
+  else
+    setenv ("TZ", zones[z], 1);
+  tzset ();
+}
+
+static void
+take (struct snapshot *s)
+{
+  int i;
+
+  memset (s, 0, sizeof *s);
+  strncpy (s->tzname[0], tzname[0], sizeof s->tzname[0] - 1);
+  strncpy (s->tzname[1], tzname[1], sizeof s->tzname[1] - 1);
+  s->timezone = _timezone;
+  s->daylight = _daylight;
+  for (i = 0; i < NTIMES; i++)
+    {
+      time_t t = sample (i);
+      struct tm tm;
+
+      localtime_r (&t, &s->tm[i]);
+      tm = s->tm[i];
+      tm.tm_isdst = -1;
+      s->mk[i] = mktime (&tm);
+    }
+}
+
+static int
+same (const struct snapshot *a, const struct snapshot *b)
+{
+  int i;
+
+  if (strcmp (a->tzname[0], b->tzname[0])
+      || strcmp (a->tzname[1], b->tzname[1])
+      || a->timezone != b->timezone || a->daylight != b->daylight)
+    return 0;
+  for (i = 0; i < NTIMES; i++)
+    if (a->tm[i].tm_sec != b->tm[i].tm_sec
+	|| a->tm[i].tm_min != b->tm[i].tm_min
+	|| a->tm[i].tm_hour != b->tm[i].tm_hour
+	|| a->tm[i].tm_mday != b->tm[i].tm_mday
+	|| a->tm[i].tm_mon != b->tm[i].tm_mon
+	|| a->tm[i].tm_year != b->tm[i].tm_year
+	|| a->tm[i].tm_isdst != b->tm[i].tm_isdst
+	|| a->mk[i] != b->mk[i])
+      return 0;
+  return 1;
+}
+
+int
+main (int argc, char **argv)
+{
+  static struct snapshot now;
+  int z, round, failed = 0;
+
+  for (z = 0; z < (int) NZONES; z++)
+    {
+      set_zone (z);
+      take (&cold[z]);
+    }
+
+  /* Back and forth between two zones, then through all of them, in an
+     order that keeps evicting and reloading.  */
+  for (round = 0; round < 4 * (int) NZONES; round++)
+    {
+      z = round < 8 ? round % 2 : (round * 7) % NZONES;
+      set_zone (z);
+      take (&now);
+      if (!same (&now, &cold[z]))
+	{
+	  fprintf (stderr, "%s: TZ=%s differs in round %d\n", argv[0],
+		   zones[z] ? zones[z] : "(unset)", round);
+	  failed = 1;
+	}
+    }
+
+  exit (failed);
+}
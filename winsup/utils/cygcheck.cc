@@ -20,6 +20,7 @@
 #include <wininet.h>
 #include "path.h"
 #include "wide_path.h"
+#include "pe.h"
 #include <getopt.h>
 #include "../cygwin/include/cygwin/version.h"
 #include "../cygwin/include/sys/cygwin.h"
@@ -446,62 +447,115 @@ already_did (const char *file)
   return d;
 }
 
-struct Section
+/* What dll_info needs from a PE image.  A DLL is typically imported by
+   many of the programs checked in one run, so the results are kept by
+   file identity and each file is only mapped and parsed once.  */
+struct pe_info
 {
-  char name[8];
-  int virtual_size;
-  int virtual_address;
-  int size_of_raw_data;
-  int pointer_to_raw_data;
+  pe_info *next;
+  DWORD volume;
+  DWORD index_high;
+  DWORD index_low;
+  bool valid;
+  WORD machine;
+  unsigned short v[6];
+  char *exp_name;
+  unsigned exp_timestamp;
+  unsigned short exp_major;
+  unsigned short exp_minor;
+  int nimports;
+  char **imports;
 };
 
-static int
-rva_to_offset (int rva, char *sections, int nsections, int *sz)
+#define PE_INFO_HASH 256
+static pe_info *pe_infos[PE_INFO_HASH];
+
+static void
+read_pe_info (HANDLE fh, LONGLONG size, pe_info *pi)
 {
-  int i;
+  HANDLE hm;
+  void *view;
+  pe_image pe;
+  pe_export exp;
+  const char *const *names;
 
-  if (sections == NULL)
+  if (size <= 0 || (LONGLONG) (size_t) size != size)
+    return;
+  if (!(hm = CreateFileMapping (fh, NULL, PAGE_READONLY, 0, 0, NULL)))
     {
-      display_error ("rva_to_offset: NULL passed for sections", true, false);
-      return 0;
+      display_error ("read_pe_info: CreateFileMapping()");
+      return;
+    }
+  if (!(view = MapViewOfFile (hm, FILE_MAP_READ, 0, 0, 0)))
+    {
+      display_error ("read_pe_info: MapViewOfFile()");
+      CloseHandle (hm);
+      return;
     }
 
-  for (i = 0; i < nsections; i++)
+  if (pe.parse (view, size))
     {
-      Section *s = (Section *) (sections + i * 40);
-#if 0
-      printf ("%08x < %08x < %08x ? %08x\n",
-	      s->virtual_address, rva,
-	      s->virtual_address + s->virtual_size, s->pointer_to_raw_data);
-#endif
-      if (rva >= s->virtual_address
-	  && rva < s->virtual_address + s->virtual_size)
+      pi->valid = true;
+      pi->machine = pe.machine ();
+      memcpy (pi->v, pe.versions (), sizeof pi->v);
+      if (pe.export_info (&exp))
 	{
-	  if (sz)
-	    *sz = s->virtual_address + s->virtual_size - rva;
-	  return rva - s->virtual_address + s->pointer_to_raw_data;
+	  if (!(pi->exp_name = strdup (exp.name)))
+	    display_error ("read_pe_info: strdup()");
+	  pi->exp_timestamp = exp.timestamp;
+	  pi->exp_major = exp.major_ver;
+	  pi->exp_minor = exp.minor_ver;
 	}
+      int n = pe.imports (&names);
+      if (n > 0 && !(pi->imports = (char **) malloc (n * sizeof (char *))))
+	display_error ("read_pe_info: malloc()");
+      else
+	for (int i = 0; i < n; i++)
+	  if ((pi->imports[pi->nimports] = strdup (names[i])))
+	    pi->nimports++;
+	  else
+	    display_error ("read_pe_info: strdup()");
     }
-  return 0;			/* punt */
+
+  UnmapViewOfFile (view);
+  CloseHandle (hm);
 }
 
-struct ExpDirectory
+static pe_info *
+get_pe_info (HANDLE fh)
 {
-  int flags;
-  int timestamp;
-  short major_ver;
-  short minor_ver;
-  int name_rva;
-};
+  BY_HANDLE_FILE_INFORMATION info;
+  pe_info *pi;
 
-struct ImpDirectory
-{
-  unsigned characteristics;
-  unsigned timestamp;
-  unsigned forwarder_chain;
-  unsigned name_rva;
-  unsigned iat_rva;
-};
+  if (!GetFileInformationByHandle (fh, &info))
+    {
+      display_error ("get_pe_info: GetFileInformationByHandle()");
+      return NULL;
+    }
+
+  pe_info **bucket = &pe_infos[(info.dwVolumeSerialNumber ^ info.nFileIndexLow)
+			       % PE_INFO_HASH];
+  for (pi = *bucket; pi; pi = pi->next)
+    if (pi->index_low == info.nFileIndexLow
+	&& pi->index_high == info.nFileIndexHigh
+	&& pi->volume == info.dwVolumeSerialNumber)
+      return pi;
+
+  pi = (pe_info *) calloc (1, sizeof (pe_info));
+  if (!pi)
+    {
+      display_error ("get_pe_info: calloc()");
+      return NULL;
+    }
+  pi->volume = info.dwVolumeSerialNumber;
+  pi->index_high = info.nFileIndexHigh;
+  pi->index_low = info.nFileIndexLow;
+  read_pe_info (fh, ((LONGLONG) info.nFileSizeHigh << 32) | info.nFileSizeLow,
+		pi);
+  pi->next = *bucket;
+  *bucket = pi;
+  return pi;
+}
 
 static bool track_down (const char *file, const char *suffix, int lvl);
 
@@ -585,7 +639,6 @@ cygwin_info (HANDLE h)
 static void
 dll_info (const char *path, HANDLE fh, int lvl, int recurse)
 {
-  DWORD junk;
   int i;
   if (is_symlink (fh))
     {
@@ -599,143 +652,60 @@ dll_info (const char *path, HANDLE fh, int lvl, int recurse)
 	}
       return;
     }
-  int pe_header_offset = get_dword (fh, 0x3c);
-  if (GetLastError () != NO_ERROR)
-    display_error ("get_dword");
-  WORD arch = get_word (fh, pe_header_offset + 4);
-  if (GetLastError () != NO_ERROR)
-    display_error ("get_word");
+
+  if (path == NULL)
+    {
+      display_error ("dll_info: NULL passed for path", true, false);
+      return;
+    }
+
+  pe_info *pi = get_pe_info (fh);
+  if (!pi || !pi->valid)
+    {
+      puts (verbose ? " (not a PE image)" : "");
+      return;
+    }
 #ifdef __x86_64__
-  if (arch != IMAGE_FILE_MACHINE_AMD64)
+  if (pi->machine != IMAGE_FILE_MACHINE_AMD64)
     {
       puts (verbose ? " (not x86_64 dll)" : "\n");
       return;
     }
-  int base_off = 108;
 #else
-  if (arch != IMAGE_FILE_MACHINE_I386)
+  if (pi->machine != IMAGE_FILE_MACHINE_I386)
     {
       puts (verbose ? " (not x86 dll)" : "\n");
       return;
     }
-  int base_off = 92;
 #endif
-  int opthdr_ofs = pe_header_offset + 4 + 20;
-  unsigned short v[6];
-
-  if (path == NULL)
-    {
-      display_error ("dll_info: NULL passed for path", true, false);
-      return;
-    }
-
-  if (SetFilePointer (fh, opthdr_ofs + 40, 0, FILE_BEGIN) ==
-      INVALID_SET_FILE_POINTER && GetLastError () != NO_ERROR)
-    display_error ("dll_info: SetFilePointer()");
-
-  if (!ReadFile (fh, &v, sizeof (v), &junk, 0))
-    display_error ("dll_info: Readfile()");
 
   if (verbose)
     printf (" - os=%d.%d img=%d.%d sys=%d.%d\n",
-	    v[0], v[1], v[2], v[3], v[4], v[5]);
+	    pi->v[0], pi->v[1], pi->v[2], pi->v[3], pi->v[4], pi->v[5]);
   else
     printf ("\n");
 
-  int num_entries = get_dword (fh, opthdr_ofs + base_off + 0);
-  if (GetLastError () != NO_ERROR)
-    display_error ("get_dword");
-  int export_rva = get_dword (fh, opthdr_ofs + base_off + 4);
-  if (GetLastError () != NO_ERROR)
-    display_error ("get_dword");
-  int export_size = get_dword (fh, opthdr_ofs + base_off + 8);
-  if (GetLastError () != NO_ERROR)
-    display_error ("get_dword");
-  int import_rva = get_dword (fh, opthdr_ofs + base_off + 12);
-  if (GetLastError () != NO_ERROR)
-    display_error ("get_dword");
-  int import_size = get_dword (fh, opthdr_ofs + base_off + 16);
-  if (GetLastError () != NO_ERROR)
-    display_error ("get_dword");
-
-  int nsections = get_word (fh, pe_header_offset + 4 + 2);
-  if (nsections == -1)
-    display_error ("get_word");
-  char *sections = (char *) malloc (nsections * 40);
-
-  if (SetFilePointer (fh, pe_header_offset + 4 + 20 +
-		      get_word (fh, pe_header_offset + 4 + 16), 0,
-		      FILE_BEGIN) == INVALID_SET_FILE_POINTER
-      && GetLastError () != NO_ERROR)
-    display_error ("dll_info: SetFilePointer()");
-
-  if (!ReadFile (fh, sections, nsections * 40, &junk, 0))
-    display_error ("dll_info: Readfile()");
-
-  if (verbose && num_entries >= 1 && export_size > 0)
-    {
-      int expsz;
-      int expbase = rva_to_offset (export_rva, sections, nsections, &expsz);
-
-      if (expbase)
-	{
-	  if (SetFilePointer (fh, expbase, 0, FILE_BEGIN) ==
-	      INVALID_SET_FILE_POINTER && GetLastError () != NO_ERROR)
-	    display_error ("dll_info: SetFilePointer()");
-
-	  unsigned char *exp = (unsigned char *) malloc (expsz);
-
-	  if (!ReadFile (fh, exp, expsz, &junk, 0))
-	    display_error ("dll_info: Readfile()");
-
-	  ExpDirectory *ed = (ExpDirectory *) exp;
-	  int ofs = ed->name_rva - export_rva;
-	  time_t ts = ed->timestamp;	/* timestamp is only 4 bytes! */
-	  struct tm *tm = localtime (&ts);
-	  if (tm && tm->tm_year < 60)
-	    tm->tm_year += 2000;
-	  if (tm && tm->tm_year < 200)
-	    tm->tm_year += 1900;
-	  printf ("%*c", lvl + 2, ' ');
-	  printf ("\"%s\" v%d.%d", exp + ofs,
-		  ed->major_ver, ed->minor_ver);
-	  if (tm)
-	    printf (" ts=%04d-%02d-%02d %02d:%02d",
-		    tm->tm_year, tm->tm_mon + 1, tm->tm_mday,
-		    tm->tm_hour, tm->tm_min);
-	  putchar ('\n');
-	}
-    }
-
-  if (num_entries >= 2 && import_size > 0 && recurse)
+  if (verbose && pi->exp_name)
     {
-      int impsz;
-      int impbase = rva_to_offset (import_rva, sections, nsections, &impsz);
-      if (impbase)
-	{
-	  if (SetFilePointer (fh, impbase, 0, FILE_BEGIN) ==
-	      INVALID_SET_FILE_POINTER && GetLastError () != NO_ERROR)
-	    display_error ("dll_info: SetFilePointer()");
-
-	  unsigned char *imp = (unsigned char *) malloc (impsz);
-	  if (imp == NULL)
-	    {
-	      display_error ("dll_info: malloc()");
-	      return;
-	    }
+      time_t ts = pi->exp_timestamp;	/* timestamp is only 4 bytes! */
+      struct tm *tm = localtime (&ts);
+      if (tm && tm->tm_year < 60)
+	tm->tm_year += 2000;
+      if (tm && tm->tm_year < 200)
+	tm->tm_year += 1900;
+      printf ("%*c", lvl + 2, ' ');
+      printf ("\"%s\" v%d.%d", pi->exp_name, pi->exp_major, pi->exp_minor);
+      if (tm)
+	printf (" ts=%04d-%02d-%02d %02d:%02d",
+		tm->tm_year, tm->tm_mon + 1, tm->tm_mday,
+		tm->tm_hour, tm->tm_min);
+      putchar ('\n');
+    }
 
-	  if (!ReadFile (fh, imp, impsz, &junk, 0))
-	    display_error ("dll_info: Readfile()");
+  if (recurse)
+    for (i = 0; i < pi->nimports; i++)
+      track_down (pi->imports[i], (char *) ".dll", lvl + 2);
 
-	  ImpDirectory *id = (ImpDirectory *) imp;
-	  for (i = 0; id[i].name_rva; i++)
-	    {
-	      /* int ofs = id[i].name_rva - import_rva; */
-	      track_down ((char *) imp + id[i].name_rva - import_rva,
-			  (char *) ".dll", lvl + 2);
-	    }
-	}
-    }
   if (strstr (path, "\\cygwin1.dll"))
     cygwin_info (fh);
 }
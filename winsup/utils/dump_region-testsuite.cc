@@ -0,0 +1,196 @@
+/* dump_region-testsuite.cc
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+/* This file implements a driver for testing the loop in dump_region.cc
+   that copies memory regions into dumper's core files.  It runs the loop
+   on synthetic regions, with a reader that returns short counts and a
+   writer into a zeroed file, so it also builds and runs on a host:
+
+     g++ -fsanitize=address -o dump_region-testsuite \
+	 dump_region-testsuite.cc dump_region.cc  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dump_region.h"
+
+#define PAGE	16
+#define BUFSIZE	(4 * PAGE)
+#define MAXSIZE	(64 * PAGE)
+
+static int numtests, numfail;
+
+#define CHECK(cond, ...) \
+  do \
+    { \
+      numtests++; \
+      if (!(cond)) \
+	{ \
+	  numfail++; \
+	  printf ("FAIL line %d: %s: ", __LINE__, #cond); \
+	  printf (__VA_ARGS__); \
+	  printf ("\n"); \
+	} \
+    } \
+  while (0)
+
+struct region
+{
+  const char *mem;
+  size_t size;
+  unsigned short_read;	/* return less than asked for every so often */
+  int fail_read;	/* read number to fail, or -1 */
+  int empty_read;	/* read number to return nothing, or -1 */
+  int fail_write;	/* write number to fail, or -1 */
+  int reads, writes;
+  char file[MAXSIZE];
+  size_t file_size;	/* end of the last byte written */
+  size_t written;
+  bool overlap;
+};
+
+static bool
+read_mem (void *ctx, size_t offset, char *buf, size_t len, size_t *done)
+{
+  region *r = (region *) ctx;
+
+  if (r->reads == r->empty_read)
+    len = 0;
+  if (r->reads++ == r->fail_read)
+    return false;
+  if (r->short_read && r->reads % 3 == 0 && len > 1)
+    len -= (r->short_read + r->reads) % (len - 1) + 1;
+  memcpy (buf, r->mem + offset, len);
+  *done = len;
+  return true;
+}
+
+static bool
+write_file (void *ctx, size_t offset, const char *buf, size_t len)
+{
+  region *r = (region *) ctx;
+
+  if (r->writes++ == r->fail_write)
+    return false;
+  for (size_t i = offset; i < offset + len; i++)
+    if (r->file[i] != 0)
+      r->overlap = true;
+  memcpy (r->file + offset, buf, len);
+  if (offset + len > r->file_size)
+    r->file_size = offset + len;
+  r->written += len;
+  return true;
+}
+
+/* Fill MEM with SIZE bytes where each page is zero unless bit N % 32 of
+   PATTERN is set for page N.  Return the number of non-zero pages.  */
+static size_t
+fill (char *mem, size_t size, unsigned pattern)
+{
+  size_t nonzero = 0;
+
+  memset (mem, 0, size);
+  for (size_t p = 0; p * PAGE < size; p++)
+    if (pattern & (1u << (p % 32)))
+      {
+	size_t n = size - p * PAGE < PAGE ? size - p * PAGE : PAGE;
+	/* Put the non-zero byte somewhere other than the start.  */
+	mem[p * PAGE + (p * 7) % n] = (char) (p + 1);
+	nonzero++;
+      }
+  return nonzero;
+}
+
+static void
+test_copy (size_t size, unsigned pattern, unsigned short_read)
+{
+  static char mem[MAXSIZE];
+  char buf[BUFSIZE];
+  region *r = (region *) calloc (1, sizeof (region));
+  size_t nonzero = fill (mem, size, pattern);
+
+  r->mem = mem;
+  r->size = size;
+  r->short_read = short_read;
+  r->fail_read = r->empty_read = r->fail_write = -1;
+  CHECK (dump_region (size, buf, BUFSIZE, PAGE, read_mem, write_file, r),
+	 "size %u pattern %#x failed", (unsigned) size, pattern);
+  CHECK (!memcmp (r->file, mem, size), "size %u pattern %#x differs",
+	 (unsigned) size, pattern);
+  CHECK (r->file_size == size, "size %u pattern %#x file size %u",
+	 (unsigned) size, pattern, (unsigned) r->file_size);
+  CHECK (!r->overlap, "size %u pattern %#x written twice", (unsigned) size,
+	 pattern);
+  /* Without short reads, pages line up with the buffer, so only the
+     non-zero pages and the last one are written.  */
+  if (!short_read)
+    CHECK (r->written <= (nonzero + 1) * PAGE, "size %u pattern %#x wrote %u",
+	   (unsigned) size, pattern, (unsigned) r->written);
+  free (r);
+}
+
+static void
+test_failure ()
+{
+  static char mem[MAXSIZE];
+  char buf[BUFSIZE];
+  region *r = (region *) calloc (1, sizeof (region));
+
+  fill (mem, MAXSIZE, 0xffffffff);
+  r->mem = mem;
+  r->size = MAXSIZE;
+
+  r->fail_read = 3;
+  r->empty_read = r->fail_write = -1;
+  CHECK (!dump_region (MAXSIZE, buf, BUFSIZE, PAGE, read_mem, write_file, r),
+	 "failed read");
+  CHECK (r->reads == 4, "%d reads after a failed one", r->reads);
+
+  r->reads = r->writes = 0;
+  r->fail_read = -1;
+  r->fail_write = 2;
+  CHECK (!dump_region (MAXSIZE, buf, BUFSIZE, PAGE, read_mem, write_file, r),
+	 "failed write");
+  CHECK (r->writes == 3, "%d writes after a failed one", r->writes);
+
+  /* A read that returns nothing must not loop forever.  */
+  r->reads = r->writes = 0;
+  r->fail_write = -1;
+  r->empty_read = 2;
+  CHECK (!dump_region (MAXSIZE, buf, BUFSIZE, PAGE, read_mem, write_file, r),
+	 "empty read");
+  CHECK (r->reads == 3, "%d reads after an empty one", r->reads);
+  free (r);
+}
+
+int
+main (int argc, char **argv)
+{
+  static const unsigned patterns[] = {
+    0, 0xffffffff, 1, 0x80000000, 0x55555555, 0x0f0f00f0, 0x12345678
+  };
+  static const size_t sizes[] = {
+    1, PAGE - 1, PAGE, PAGE + 1, BUFSIZE, BUFSIZE + 3, 5 * PAGE + 7,
+    MAXSIZE - 1, MAXSIZE
+  };
+
+  for (unsigned s = 0; s < sizeof sizes / sizeof *sizes; s++)
+    for (unsigned p = 0; p < sizeof patterns / sizeof *patterns; p++)
+      for (unsigned short_read = 0; short_read < 3; short_read++)
+	test_copy (sizes[s], patterns[p], short_read);
+  test_failure ();
+
+  printf ("\n"
+	  "total tests: %d\n"
+	  "pass       : %d (%.1f%%)\n"
+	  "fail       : %d (%.1f%%)\n",
+	  numtests, numtests - numfail,
+	  ((float) numtests - numfail) / numtests * 100.0F, numfail,
+	  ((float) numfail) / numtests * 100.0F);
+  return numfail ? 1 : 0;
+}
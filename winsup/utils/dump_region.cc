@@ -0,0 +1,63 @@
+/* dump_region.cc
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#include <string.h>
+#include "dump_region.h"
+
+static bool
+page_is_zero (const char *p, size_t n)
+{
+  return p[0] == 0 && memcmp (p, p + 1, n - 1) == 0;
+}
+
+bool
+dump_region (size_t size, char *buf, size_t bufsize, size_t pagesize,
+	     dump_read_fn read, dump_write_fn write, void *ctx)
+{
+  size_t pos = 0;
+
+  while (pos < size)
+    {
+      size_t todo = size - pos < bufsize ? size - pos : bufsize;
+      size_t done = 0;
+
+      if (!read (ctx, pos, buf, todo, &done) || done == 0)
+	return false;
+      if (done > todo)
+	done = todo;
+
+      /* The page that ends the region is always written.  */
+      bool last = pos + done == size;
+      size_t start = 0, end;
+      while (start < done)
+	{
+	  for (end = start; end < done; end += pagesize)
+	    {
+	      size_t n = done - end < pagesize ? done - end : pagesize;
+	      if ((!last || end + n < done) && page_is_zero (buf + end, n))
+		break;
+	    }
+	  if (end > done)
+	    end = done;
+	  if (end > start && !write (ctx, pos + start, buf + start,
+				     end - start))
+	    return false;
+	  /* Skip the run of zero pages that stopped us.  */
+	  for (start = end; start < done; start += pagesize)
+	    {
+	      size_t n = done - start < pagesize ? done - start : pagesize;
+	      if ((last && start + n >= done) || !page_is_zero (buf + start, n))
+		break;
+	    }
+	  if (start > done)
+	    start = done;
+	}
+      pos += done;
+    }
+  return true;
+}
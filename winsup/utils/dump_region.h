@@ -0,0 +1,36 @@
+/* dump_region.h
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#ifndef _DUMP_REGION_H
+#define _DUMP_REGION_H
+
+/* The loop dumper uses to copy a memory region into the core file.  The
+   reading and writing are done by callbacks, so the loop needs no Windows
+   or BFD headers and can be tested on its own.  */
+
+#include <stddef.h>
+
+/* Read up to LEN bytes at OFFSET into the region and set *DONE to the
+   number read.  Return false on failure.  */
+typedef bool (*dump_read_fn) (void *ctx, size_t offset, char *buf,
+			      size_t len, size_t *done);
+
+/* Write LEN bytes at OFFSET into the section.  Return false on failure.  */
+typedef bool (*dump_write_fn) (void *ctx, size_t offset, const char *buf,
+			       size_t len);
+
+/* Copy the SIZE bytes of a region through BUF, BUFSIZE bytes at a time.
+   Runs of non-zero pages of PAGESIZE bytes go out in one write each.
+   Whole zero pages are not written, since the file reads back zeros
+   there, except for the last page of the region, so the file is never
+   shorter than its sections.  Return false if a callback failed or a
+   read made no progress.  */
+bool dump_region (size_t size, char *buf, size_t bufsize, size_t pagesize,
+		  dump_read_fn read, dump_write_fn write, void *ctx);
+
+#endif /* _DUMP_REGION_H */
@@ -31,11 +31,13 @@
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/param.h>
 #include <windows.h>
 
 #include "dumper.h"
+#include "dump_region.h"
 
 #define NOTE_NAME_SIZE 16
 
@@ -74,6 +76,7 @@ dumper::dumper (DWORD pid, DWORD tid, const char *file_name)
   list = last = NULL;
 
   status_section = NULL;
+  dump_buf = NULL;
 
   memory_num = module_num = thread_num = 0;
 
@@ -115,7 +118,9 @@ dumper::close ()
     delete excl_list;
   if (hProcess)
     CloseHandle (hProcess);
+  free (dump_buf);
   core_bfd = NULL;
+  dump_buf = NULL;
   hProcess = NULL;
   excl_list = NULL;
 }
@@ -362,40 +367,72 @@ dumper::collect_memory_sections ()
   return 1;
 };
 
+/* Memory regions are copied to the core file in chunks of this size, to
+   keep the number of ReadProcessMemory calls and BFD writes down.  */
+#define DUMP_BUFFER_SIZE (1024 * 1024)
+
+struct dump_region_ctx
+{
+  HANDLE hProcess;
+  LPBYTE base;
+  bfd *core_bfd;
+  asection *to;
+  bool write_failed;
+};
+
+static bool
+read_region (void *ctx, size_t offset, char *buf, size_t len, size_t *done)
+{
+  dump_region_ctx *c = (dump_region_ctx *) ctx;
+  SIZE_T n;
+
+  if (!ReadProcessMemory (c->hProcess, c->base + offset, buf, len, &n))
+    {
+      deb_printf ("Failed to read process memory at %p(%zx), error %ld\n",
+		  c->base + offset, len, GetLastError ());
+      return false;
+    }
+  *done = n;
+  return true;
+}
+
+static bool
+write_region (void *ctx, size_t offset, const char *buf, size_t len)
+{
+  dump_region_ctx *c = (dump_region_ctx *) ctx;
+
+  if (!bfd_set_section_contents (c->core_bfd, c->to, buf, offset, len))
+    {
+      bfd_perror ("writing memory region to bfd");
+      c->write_failed = true;
+      return false;
+    }
+  return true;
+}
+
 int
 dumper::dump_memory_region (asection * to, process_mem_region * memory)
 {
   if (!sane ())
     return 0;
 
-  SIZE_T size = memory->size;
-  SIZE_T todo;
-  SIZE_T done;
-  LPBYTE pos = memory->base;
-  DWORD sect_pos = 0;
-
   if (to == NULL || memory == NULL)
     return 0;
 
-  char mem_buf[PAGE_BUFFER_SIZE];
+  if (dump_buf == NULL
+      && (dump_buf = (char *) malloc (DUMP_BUFFER_SIZE)) == NULL)
+    {
+      fprintf (stderr, "Failed to allocate memory for dumping\n");
+      return 0;
+    }
 
-  while (size > 0)
+  dump_region_ctx ctx = { hProcess, memory->base, core_bfd, to, false };
+  if (!dump_region (memory->size, dump_buf, DUMP_BUFFER_SIZE,
+		    PAGE_BUFFER_SIZE, read_region, write_region, &ctx))
     {
-      todo = MIN (size, PAGE_BUFFER_SIZE);
-      if (!ReadProcessMemory (hProcess, pos, mem_buf, todo, &done))
-	{
-	  deb_printf ("Failed to read process memory at %x(%x), error %ld\n", pos, todo, GetLastError ());
-	  return 0;
-	}
-      size -= done;
-      pos += done;
-      if (!bfd_set_section_contents (core_bfd, to, mem_buf, sect_pos, done))
-	{
-	  bfd_perror ("writing memory region to bfd");
-	  dumper_abort ();
-	  return 0;
-	};
-      sect_pos += done;
+      if (ctx.write_failed)
+	dumper_abort ();
+      return 0;
     }
   return 1;
 }
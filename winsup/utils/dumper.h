@@ -94,6 +94,8 @@ class dumper
 
   asection* status_section;
 
+  char* dump_buf; /* for copying memory regions */
+
   int memory_num;
   int module_num;
   int thread_num;
@@ -41,6 +41,7 @@
 #include <windows.h>
 #include <imagehlp.h>
 #include <psapi.h>
+#include "pe.h"
 
 struct option longopts[] =
 {
@@ -429,26 +430,18 @@ main (int argc, char **argv)
 static bool printing = false;
 
 
-/* dump of import directory
-   section begins at pointer 'section base'
-   section RVA is 'section_rva'
-   import directory begins at pointer 'imp' */
-static int
-dump_import_directory (const void *const section_base,
-		       const DWORD section_rva,
-		       const IMAGE_IMPORT_DESCRIPTOR *imp)
+/* print the DLLs in NAMES that are not found on the search path, and
+   once one is missing, any that follow it */
+static void
+dump_import_directory (const char *const *names, int n)
 {
-  /* get memory address given the RVA */
-  #define adr(rva) ((const void*) ((char*) section_base+((DWORD) (rva))-section_rva))
-
-  /* continue until address inaccessible or there's no DLL name */
-  for (; !IsBadReadPtr (imp, sizeof (*imp)) && imp->Name; imp++)
+  for (int i = 0; i < n; i++)
     {
       wchar_t full_path[PATH_MAX];
       wchar_t *dummy;
-      char *fn = (char *) adr (imp->Name);
+      const char *fn = names[i];
 
-      if (saw_file (fn))
+      if (saw_file ((char *) fn))
 	continue;
 
       int len = mbstowcs (NULL, fn, 0);
@@ -471,28 +464,33 @@ dump_import_directory (const void *const section_base,
 	  strcat (print_fn, " (?)");
 	}
 
-      printf ("\t%s => %s\n", (char *) fn, print_fn);
+      printf ("\t%s => %s\n", fn, print_fn);
       free (print_fn);
     }
-  #undef adr
-
-  return 0;
 }
 
 /* load a file in RAM (memory-mapped)
-   return pointer to loaded file
+   return pointer to loaded file and its size in *SIZE
    0 if no success  */
 static void *
-map_file (const wchar_t *filename)
+map_file (const wchar_t *filename, size_t *size)
 {
   HANDLE hFile, hMapping;
   void *basepointer;
+  LARGE_INTEGER fsize;
   if ((hFile = CreateFileW (filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
 			   0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0)) == INVALID_HANDLE_VALUE)
     {
       fprintf (stderr, "couldn't open %ls\n", filename);
       return 0;
     }
+  if (!GetFileSizeEx (hFile, &fsize))
+    {
+      fprintf (stderr, "GetFileSizeEx failed with windows error %u\n",
+	       (unsigned int) GetLastError ());
+      CloseHandle (hFile);
+      return 0;
+    }
   if (!(hMapping = CreateFileMapping (hFile, 0, PAGE_READONLY | SEC_COMMIT, 0, 0, 0)))
     {
       fprintf (stderr, "CreateFileMapping failed with windows error %u\n",
@@ -512,54 +510,10 @@ map_file (const wchar_t *filename)
   CloseHandle (hMapping);
   CloseHandle (hFile);
 
+  *size = fsize.QuadPart;
   return basepointer;
 }
 
-
-/* this will return a pointer immediatly behind the DOS-header
-   0 if error */
-static void *
-skip_dos_stub (const IMAGE_DOS_HEADER *dos_ptr)
-{
-  /* look there's enough space for a DOS-header */
-  if (IsBadReadPtr (dos_ptr, sizeof (*dos_ptr)))
-      {
-	fprintf (stderr, "not enough space for DOS-header\n");
-	return 0;
-      }
-
-   /* validate MZ */
-   if (dos_ptr->e_magic != IMAGE_DOS_SIGNATURE)
-      {
-	fprintf (stderr, "not a DOS-stub\n");
-	return 0;
-      }
-
-  /* ok, then, go get it */
-  return (char*) dos_ptr + dos_ptr->e_lfanew;
-}
-
-
-/* find the directory's section index given the RVA
-   Returns -1 if impossible */
-static int
-get_directory_index (const unsigned dir_rva,
-		     const unsigned dir_length,
-		     const int number_of_sections,
-		     const IMAGE_SECTION_HEADER *sections)
-{
-  int sect;
-  for (sect = 0; sect < number_of_sections; sect++)
-  {
-    /* compare directory RVA to section RVA */
-    if (sections[sect].VirtualAddress <= dir_rva
-       && dir_rva < sections[sect].VirtualAddress+sections[sect].SizeOfRawData)
-      return sect;
-  }
-
-  return -1;
-}
-
 /* dump imports of a single file
    Returns 0 if successful, !=0 else */
 static int
@@ -568,112 +522,36 @@ process_file (const wchar_t *filename)
   void *basepointer;    /* Points to loaded PE file
 			 * This is memory mapped stuff
 			 */
-  int number_of_sections;
-  DWORD import_rva;           /* RVA of import directory */
-  DWORD import_length;        /* length of import directory */
-  int import_index;           /* index of section with import directory */
-
-  /* ensure byte-alignment for struct tag_header */
-  #include <pshpack1.h>
-
-  const struct tag_header
-    {
-      DWORD signature;
-      IMAGE_FILE_HEADER file_head;
-      IMAGE_OPTIONAL_HEADER opt_head;
-      IMAGE_SECTION_HEADER section_header[1];  /* an array of unknown length */
-    } *header;
-
-  /* revert to regular alignment */
-  #include <poppack.h>
+  size_t size;
+  pe_image pe;
+  const char *const *names;
+  int n;
 
   printing = false;
 
   /* first, load file */
-  basepointer = map_file (filename);
+  basepointer = map_file (filename, &size);
   if (!basepointer)
       {
 	puts ("cannot load file");
 	return 1;
       }
 
-  /* get header pointer; validate a little bit */
-  header = (tag_header *) skip_dos_stub ((IMAGE_DOS_HEADER *) basepointer);
-  if (!header)
+  /* validate the headers; pe checks every offset against SIZE */
+  if (!pe.parse (basepointer, size))
       {
-	puts ("cannot skip DOS stub");
+	puts ("not a PE file");
 	UnmapViewOfFile (basepointer);
 	return 2;
       }
 
-  /* look there's enough space for PE headers */
-  if (IsBadReadPtr (header, sizeof (*header)))
+  if ((n = pe.imports (&names)) < 0)
       {
-	puts ("not enough space for PE headers");
+	puts ("out of memory");
 	UnmapViewOfFile (basepointer);
 	return 3;
       }
-
-  /* validate PE signature */
-  if (header->signature != IMAGE_NT_SIGNATURE)
-      {
-	puts ("not a PE file");
-	UnmapViewOfFile (basepointer);
-	return 4;
-      }
-
-  /* get number of sections */
-  number_of_sections = header->file_head.NumberOfSections;
-
-  /* check there are sections... */
-  if (number_of_sections < 1)
-      {
-	UnmapViewOfFile (basepointer);
-	return 5;
-      }
-
-  /* validate there's enough space for section headers */
-  if (IsBadReadPtr (header->section_header, number_of_sections*sizeof (IMAGE_SECTION_HEADER)))
-      {
-	puts ("not enough space for section headers");
-	UnmapViewOfFile (basepointer);
-	return 6;
-      }
-
-  /* get RVA and length of import directory */
-  import_rva = header->opt_head.DataDirectory[IMAGE_DIRECTORY_ENTRY_IMPORT].VirtualAddress;
-  import_length = header->opt_head.DataDirectory[IMAGE_DIRECTORY_ENTRY_IMPORT].Size;
-
-  /* check there's stuff to care about */
-  if (!import_rva || !import_length)
-      {
-	UnmapViewOfFile (basepointer);
-	return 0;       /* success! */
-    }
-
-  /* get import directory pointer */
-  import_index = get_directory_index (import_rva,import_length,number_of_sections,header->section_header);
-
-  /* check directory was found */
-  if (import_index < 0)
-      {
-	puts ("couldn't find import directory in sections");
-	UnmapViewOfFile (basepointer);
-	return 7;
-      }
-
-  /* The pointer to the start of the import directory's section */
-  const void *section_address = (char*) basepointer + header->section_header[import_index].PointerToRawData;
-  if (dump_import_directory (section_address,
-			   header->section_header[import_index].VirtualAddress,
-				    /* the last parameter is the pointer to the import directory:
-				       section address + (import RVA - section RVA)
-				       The difference is the offset of the import directory in the section */
-			   (const IMAGE_IMPORT_DESCRIPTOR *) ((char *) section_address+import_rva-header->section_header[import_index].VirtualAddress)))
-    {
-      UnmapViewOfFile (basepointer);
-      return 8;
-    }
+  dump_import_directory (names, n);
 
   UnmapViewOfFile (basepointer);
   return 0;
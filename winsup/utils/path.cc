@@ -261,6 +261,7 @@ int max_mount_entry;
 #  define TESTSUITE_MOUNT_TABLE
 #  include "testsuite.h"
 #  undef TESTSUITE_MOUNT_TABLE
+int max_mount_entry;
 #endif
 
 inline void
@@ -575,6 +576,72 @@ mnt_sort (const void *a, const void *b)
   return strcmp (ma->posix, mb->posix);
 }
 
+/* Hash indices of the mount table, used by find_mount to look up the
+   mount point matching a path without comparing the path against every
+   entry.  This mirrors mount_info::find_mount in the DLL.  Cygdrive
+   entries match differently and are not indexed. */
+#define MOUNT_HASH_SIZE 512
+
+struct mnt_hash_t
+{
+  unsigned key;
+  short len;		/* length of the path without a trailing slash */
+  short idx;		/* index into mount_table + 1, 0 if unused */
+};
+
+static mnt_hash_t posix_hash[MOUNT_HASH_SIZE];
+static mnt_hash_t native_hash[MOUNT_HASH_SIZE];
+
+#define MOUNT_HASH_INIT 2166136261U
+
+/* Add C to KEY, ignoring case as path_prefix_p does. */
+static inline unsigned
+mount_hash_step (unsigned key, char c)
+{
+  unsigned char uc = c;
+
+  if (uc >= 0x80)
+    uc = 0x80;
+  else if (uc >= 'A' && uc <= 'Z')
+    uc += 'a' - 'A';
+  return (key ^ uc) * 16777619U;
+}
+
+static void
+mount_hash_add (mnt_hash_t *tab, const char *path, int idx)
+{
+  unsigned key = MOUNT_HASH_INIT;
+  int len = strlen (path);
+
+  if (len > 0 && isslash (path[len - 1]))
+    len--;
+  for (int i = 0; i < len; i++)
+    key = mount_hash_step (key, path[i]);
+
+  int slot = key & (MOUNT_HASH_SIZE - 1);
+  while (tab[slot].idx)
+    slot = (slot + 1) & (MOUNT_HASH_SIZE - 1);
+  tab[slot].key = key;
+  tab[slot].len = len;
+  tab[slot].idx = idx + 1;
+}
+
+/* Rebuild the indices.  Of two entries for the same path, the scans this
+   replaces chose the later one, so insert from the end of the table to
+   make it the first one found. */
+static void
+index_mounts ()
+{
+  memset (posix_hash, 0, sizeof posix_hash);
+  memset (native_hash, 0, sizeof native_hash);
+  for (int i = max_mount_entry - 1; i >= 0; i--)
+    if (!(mount_table[i].flags & MOUNT_CYGDRIVE))
+      {
+	mount_hash_add (posix_hash, mount_table[i].posix, i);
+	mount_hash_add (native_hash, mount_table[i].native, i);
+      }
+}
+
 extern "C" WCHAR cygwin_dll_path[];
 
 static void
@@ -654,7 +721,12 @@ read_mounts ()
   from_fstab (false, path, path_end);
   from_fstab (true, path, path_end);
   qsort (mount_table, max_mount_entry, sizeof (mnt_t), mnt_sort);
+#else
+  for (max_mount_entry = 0; mount_table[max_mount_entry].posix;
+       max_mount_entry++)
+    ;
 #endif /* !defined(TESTSUITE) */
+  index_mounts ();
 }
 
 /* Return non-zero if PATH1 is a prefix of PATH2.
@@ -687,6 +759,39 @@ path_prefix_p (const char *path1, const char *path2, size_t len1)
   return isslash (path2[len1]) || path2[len1] == 0 || path1[len1 - 1] == ':';
 }
 
+/* Return the longest non-cygdrive mount point whose POSIX resp. native
+   path is a prefix of PATH.  Only prefixes ending at a slash, at the end
+   of PATH or after a colon can match, so hash PATH once and look up each
+   of them. */
+static mnt_t *
+find_mount (const char *path, bool native)
+{
+  mnt_hash_t *tab = native ? native_hash : posix_hash;
+  mnt_t *found = NULL;
+  unsigned key = MOUNT_HASH_INIT;
+
+  for (const char *p = path; ; key = mount_hash_step (key, *p++))
+    {
+      if (isslash (*p) || !*p || (p > path && p[-1] == ':'))
+	for (int slot = key & (MOUNT_HASH_SIZE - 1); tab[slot].idx;
+	     slot = (slot + 1) & (MOUNT_HASH_SIZE - 1))
+	  {
+	    if (tab[slot].key != key || tab[slot].len != p - path)
+	      continue;
+	    mnt_t *m = mount_table + tab[slot].idx - 1;
+	    const char *mp = native ? m->native : m->posix;
+	    if (path_prefix_p (mp, path, strlen (mp)))
+	      {
+		found = m;
+		break;
+	      }
+	  }
+      if (!*p)
+	break;
+    }
+  return found;
+}
+
 static char *
 vconcat (const char *s, va_list v)
 {
@@ -778,20 +883,8 @@ rel_vconcat (const char *cwd, const char *s, va_list v)
       cwd = pathbuf;
     }
 
-  int max_len = 0;
-  mnt_t *m, *match = NULL;
-
-  for (m = mount_table; m->posix; m++)
-    {
-      if (m->flags & MOUNT_CYGDRIVE)
-	continue;
-
-      size_t n = strlen (m->native);
-      if (n < max_len || !path_prefix_p (m->native, cwd, n))
-	continue;
-      max_len = n;
-      match = m;
-    }
+  mnt_t *match = find_mount (cwd, true);
+  int max_len = match ? strlen (match->native) : 0;
 
   char *temppath;
   if (!match)
@@ -821,8 +914,8 @@ rel_vconcat (const char *cwd, const char *s, va_list v)
 static char *
 vcygpath (const char *cwd, const char *s, va_list v)
 {
-  size_t max_len = 0;
-  mnt_t *m, *match = NULL;
+  size_t max_len;
+  mnt_t *m, *match;
 
   if (!max_mount_entry)
     read_mounts ();
@@ -841,25 +934,27 @@ vcygpath (const char *cwd, const char *s, va_list v)
   if (strncmp (path, "/./", 3) == 0)
     memmove (path + 1, path + 3, strlen (path + 3) + 1);
 
+  /* Cygdrive mounts are not in the index, see find_mount. */
+  match = find_mount (path, false);
+  max_len = match ? strlen (match->posix) : 0;
   for (m = mount_table; m->posix; m++)
     {
+      if (!(m->flags & MOUNT_CYGDRIVE))
+	continue;
       size_t n = strlen (m->posix);
       if (n < max_len || !path_prefix_p (m->posix, path, n))
 	continue;
-      if (m->flags & MOUNT_CYGDRIVE)
-	{
-	  if (strlen (path) < n + 2)
-	    continue;
-	  /* If cygdrive path is just '/', fix n for followup evaluation. */
-	  if (n == 1)
-	    n = 0;
-	  if (path[n] != '/')
-	    continue;
-	  if (!isalpha (path[n + 1]))
-	    continue;
-	  if (path[n + 2] != '/')
-	    continue;
-	}
+      if (strlen (path) < n + 2)
+	continue;
+      /* If cygdrive path is just '/', fix n for followup evaluation. */
+      if (n == 1)
+	n = 0;
+      if (path[n] != '/')
+	continue;
+      if (!isalpha (path[n + 1]))
+	continue;
+      if (path[n + 2] != '/')
+	continue;
       max_len = n;
       match = m;
     }
@@ -0,0 +1,264 @@
+/* pe-testsuite.cc
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+/* This file implements a driver for testing the PE reader in pe.cc on
+   small synthetic images.  Like pe.cc it needs no Windows headers, so it
+   also builds and runs on a little-endian host:
+
+     g++ -fsanitize=address -o pe-testsuite pe-testsuite.cc pe.cc
+
+   Every truncated copy of each image is parsed from a buffer of exactly
+   its size, so that reading beyond the end shows up under a memory
+   checker.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pe.h"
+
+#define IMAGE_SIZE	0x400
+#define PE_OFS		0x40
+#define SECTION_RAW	0x200
+#define SECTION_VA	0x1000
+#define IMPORT_RVA	0x1000
+#define EXPORT_RVA	0x1080
+#define NAMES_RVA	0x1100
+
+static const char *const dll_names[] = { "KERNEL32.dll", "cygwin1.dll" };
+#define NDLLS (sizeof dll_names / sizeof *dll_names)
+static const char export_name[] = "cygtest-1.dll";
+
+static int numtests, numfail;
+
+#define CHECK(cond, ...) \
+  do \
+    { \
+      numtests++; \
+      if (!(cond)) \
+	{ \
+	  numfail++; \
+	  printf ("FAIL line %d: %s: ", __LINE__, #cond); \
+	  printf (__VA_ARGS__); \
+	  printf ("\n"); \
+	} \
+    } \
+  while (0)
+
+static void
+put16 (unsigned char *p, uint16_t v)
+{
+  memcpy (p, &v, sizeof v);
+}
+
+static void
+put32 (unsigned char *p, uint32_t v)
+{
+  memcpy (p, &v, sizeof v);
+}
+
+/* Build an image with one section holding an import directory for
+   dll_names and an export directory for export_name.  Return the offset
+   of the section table.  */
+static unsigned
+build (unsigned char *img, bool plus)
+{
+  unsigned opt = PE_OFS + 4 + 20;
+  unsigned dirofs = plus ? 108 : 92;
+  unsigned optsize = dirofs + 4 + 16 * 8;
+  unsigned sect = opt + optsize;
+  unsigned char *raw = img + SECTION_RAW;
+  uint32_t rva = NAMES_RVA;
+
+  memset (img, 0, IMAGE_SIZE);
+  put16 (img, 0x5a4d);
+  put32 (img + 0x3c, PE_OFS);
+  memcpy (img + PE_OFS, "PE\0\0", 4);
+  put16 (img + PE_OFS + 4, plus ? 0x8664 : 0x14c);
+  put16 (img + PE_OFS + 4 + 2, 1);
+  put16 (img + PE_OFS + 4 + 16, optsize);
+  put16 (img + opt, plus ? 0x20b : 0x10b);
+  for (int i = 0; i < 6; i++)
+    put16 (img + opt + 40 + 2 * i, 4 + i);
+  put32 (img + opt + dirofs, 16);
+  put32 (img + opt + dirofs + 4, EXPORT_RVA);
+  put32 (img + opt + dirofs + 8, 40);
+  put32 (img + opt + dirofs + 12, IMPORT_RVA);
+  put32 (img + opt + dirofs + 16, (NDLLS + 1) * 20);
+
+  memcpy (img + sect, ".rdata", 6);
+  put32 (img + sect + 8, IMAGE_SIZE - SECTION_RAW);
+  put32 (img + sect + 12, SECTION_VA);
+  put32 (img + sect + 16, IMAGE_SIZE - SECTION_RAW);
+  put32 (img + sect + 20, SECTION_RAW);
+
+  for (unsigned i = 0; i < NDLLS; i++)
+    {
+      put32 (raw + IMPORT_RVA - SECTION_VA + 20 * i + 12, rva);
+      strcpy ((char *) raw + rva - SECTION_VA, dll_names[i]);
+      rva += strlen (dll_names[i]) + 1;
+    }
+
+  put32 (raw + EXPORT_RVA - SECTION_VA + 4, 0x5e5e5e5e);
+  put16 (raw + EXPORT_RVA - SECTION_VA + 8, 3);
+  put16 (raw + EXPORT_RVA - SECTION_VA + 10, 7);
+  put32 (raw + EXPORT_RVA - SECTION_VA + 12, rva);
+  strcpy ((char *) raw + rva - SECTION_VA, export_name);
+  return sect;
+}
+
+/* Parse the first LEN bytes of IMG from a buffer of exactly that size.
+   Whatever is found must agree with the complete image.  Return whether
+   the headers parsed.  */
+static bool
+parse_copy (const unsigned char *img, size_t len, bool plus, bool full)
+{
+  unsigned char *copy = (unsigned char *) malloc (len ?: 1);
+  const char *const *names;
+  pe_export exp;
+  int n;
+  bool ok;
+
+  memcpy (copy, img, len);
+  {
+    pe_image pe;
+
+    ok = pe.parse (copy, len);
+    if (ok)
+      {
+	CHECK (pe.machine () == (plus ? 0x8664 : 0x14c),
+	       "len %u machine %#x", (unsigned) len, pe.machine ());
+	CHECK (pe.versions ()[0] == 4 && pe.versions ()[5] == 9,
+	       "len %u versions %u..%u", (unsigned) len, pe.versions ()[0],
+	       pe.versions ()[5]);
+
+	n = pe.imports (&names);
+	CHECK (n >= 0 && n <= (int) NDLLS, "len %u %d imports",
+	       (unsigned) len, n);
+	for (int i = 0; i < n; i++)
+	  CHECK (!strcmp (names[i], dll_names[i]), "len %u import %d %s",
+		 (unsigned) len, i, names[i]);
+	if (full)
+	  CHECK (n == (int) NDLLS, "%d imports", n);
+	/* The second call returns the same list.  */
+	const char *const *again;
+	CHECK (pe.imports (&again) == n && again == names,
+	       "len %u imports not cached", (unsigned) len);
+
+	if (pe.export_info (&exp))
+	  {
+	    CHECK (!strcmp (exp.name, export_name), "len %u export %s",
+		   (unsigned) len, exp.name);
+	    CHECK (exp.timestamp == 0x5e5e5e5e && exp.major_ver == 3
+		   && exp.minor_ver == 7, "len %u export %#x %u.%u",
+		   (unsigned) len, exp.timestamp, exp.major_ver,
+		   exp.minor_ver);
+	  }
+	else
+	  CHECK (!full, "no export info");
+      }
+  }
+  free (copy);
+  return ok;
+}
+
+static void
+test_image (bool plus)
+{
+  unsigned char img[IMAGE_SIZE];
+  unsigned char bad[IMAGE_SIZE];
+  unsigned sect = build (img, plus);
+  unsigned opt = PE_OFS + 4 + 20;
+  unsigned dirofs = plus ? 108 : 92;
+  pe_image pe;
+
+  CHECK (parse_copy (img, IMAGE_SIZE, plus, true), "%s does not parse",
+	 plus ? "PE32+" : "PE32");
+
+  /* Truncated copies parse once the section table is there, and only
+     ever return what they hold completely.  */
+  for (size_t len = 0; len < IMAGE_SIZE; len++)
+    {
+      bool ok = parse_copy (img, len, plus, false);
+
+      CHECK (ok == (len >= sect), "%s truncated to %u parses: %d",
+	     plus ? "PE32+" : "PE32", (unsigned) len, ok);
+    }
+
+  /* Broken headers.  */
+  memcpy (bad, img, IMAGE_SIZE);
+  put16 (bad, 0x5a4e);
+  CHECK (!pe.parse (bad, IMAGE_SIZE), "bad DOS magic");
+  memcpy (bad, img, IMAGE_SIZE);
+  put32 (bad + 0x3c, 0xfffffff0);
+  CHECK (!pe.parse (bad, IMAGE_SIZE), "e_lfanew beyond the end");
+  memcpy (bad, img, IMAGE_SIZE);
+  put16 (bad + opt, 0x107);
+  CHECK (!pe.parse (bad, IMAGE_SIZE), "bad optional header magic");
+  memcpy (bad, img, IMAGE_SIZE);
+  put16 (bad + PE_OFS + 4 + 16, dirofs);
+  CHECK (!pe.parse (bad, IMAGE_SIZE), "optional header too small");
+  memcpy (bad, img, IMAGE_SIZE);
+  put16 (bad + PE_OFS + 4 + 16, 0xffff);
+  CHECK (!pe.parse (bad, IMAGE_SIZE), "optional header too large");
+
+  /* Counts larger than the headers hold are clamped.  */
+  memcpy (bad, img, IMAGE_SIZE);
+  put32 (bad + opt + dirofs, 0xffffffff);
+  put16 (bad + PE_OFS + 4 + 2, 0xffff);
+  CHECK (parse_copy (bad, IMAGE_SIZE, plus, true), "large counts");
+
+  /* A section whose raw data runs beyond the file.  */
+  memcpy (bad, img, IMAGE_SIZE);
+  put32 (bad + sect + 16, 0x10000);
+  CHECK (parse_copy (bad, IMAGE_SIZE, plus, true), "long raw size");
+  memcpy (bad, img, IMAGE_SIZE);
+  put32 (bad + sect + 20, 0xfffffe00);
+  CHECK (parse_copy (bad, IMAGE_SIZE, plus, false), "raw data offset");
+
+  /* An export name without its NUL.  */
+  memcpy (bad, img, IMAGE_SIZE);
+  {
+    const char *const *names;
+    pe_export exp;
+    uint32_t rva;
+
+    memcpy (&rva, bad + SECTION_RAW + EXPORT_RVA - SECTION_VA + 12,
+	    sizeof rva);
+    memset (bad + SECTION_RAW + rva - SECTION_VA, 'x',
+	    IMAGE_SIZE - SECTION_RAW - (rva - SECTION_VA));
+    CHECK (pe.parse (bad, IMAGE_SIZE), "unterminated name");
+    CHECK (!pe.export_info (&exp), "unterminated export name");
+    CHECK (pe.imports (&names) == (int) NDLLS, "imports next to it");
+  }
+
+  /* No import directory at all.  */
+  memcpy (bad, img, IMAGE_SIZE);
+  put32 (bad + opt + dirofs + 12, 0);
+  {
+    const char *const *names;
+
+    CHECK (pe.parse (bad, IMAGE_SIZE), "no imports");
+    CHECK (pe.imports (&names) == 0, "imports without a directory");
+  }
+}
+
+int
+main (int argc, char **argv)
+{
+  test_image (false);
+  test_image (true);
+
+  printf ("\n"
+	  "total tests: %d\n"
+	  "pass       : %d (%.1f%%)\n"
+	  "fail       : %d (%.1f%%)\n",
+	  numtests, numtests - numfail,
+	  ((float) numtests - numfail) / numtests * 100.0F, numfail,
+	  ((float) numfail) / numtests * 100.0F);
+  return numfail ? 1 : 0;
+}
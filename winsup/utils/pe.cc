@@ -0,0 +1,208 @@
+/* pe.cc
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#include <stdlib.h>
+#include <string.h>
+#include "pe.h"
+
+#define DOS_MAGIC		0x5a4d		/* "MZ" */
+#define DOS_LFANEW		0x3c
+#define PE_SIGNATURE		0x00004550	/* "PE\0\0" */
+#define FILE_HEADER_SIZE	20
+#define OPT_MAGIC_PE32		0x10b
+#define OPT_MAGIC_PE32PLUS	0x20b
+#define OPT_VERSIONS		40
+#define SECTION_SIZE		40
+#define IMPORT_DESC_SIZE	20
+#define EXPORT_DIR_SIZE		40
+
+/* The image may be mapped at any address, so read fields bytewise.  */
+static inline uint16_t
+get16 (const unsigned char *p)
+{
+  uint16_t v;
+  memcpy (&v, p, sizeof v);
+  return v;
+}
+
+static inline uint32_t
+get32 (const unsigned char *p)
+{
+  uint32_t v;
+  memcpy (&v, p, sizeof v);
+  return v;
+}
+
+pe_image::~pe_image ()
+{
+  free (imports_);
+}
+
+bool
+pe_image::parse (const void *p, size_t n)
+{
+  const unsigned char *b = (const unsigned char *) p;
+  uint32_t pe, opt, optsize, dirofs;
+
+  if (n < DOS_LFANEW + 4 || get16 (b) != DOS_MAGIC)
+    return false;
+  pe = get32 (b + DOS_LFANEW);
+  if (pe > n || n - pe < 4 + FILE_HEADER_SIZE || get32 (b + pe) != PE_SIGNATURE)
+    return false;
+
+  opt = pe + 4 + FILE_HEADER_SIZE;
+  optsize = get16 (b + pe + 4 + 16);
+  if (n - opt < optsize)
+    return false;
+  switch (optsize >= 2 ? get16 (b + opt) : 0)
+    {
+    case OPT_MAGIC_PE32:
+      dirofs = 92;
+      break;
+    case OPT_MAGIC_PE32PLUS:
+      dirofs = 108;
+      break;
+    default:
+      return false;
+    }
+  if (optsize < dirofs + 4)
+    return false;
+
+  base = b;
+  len = n;
+  machine_ = get16 (b + pe + 4);
+  for (int i = 0; i < 6; i++)
+    versions_[i] = get16 (b + opt + OPT_VERSIONS + 2 * i);
+
+  /* Only count the data directories the optional header has room for.  */
+  ndirs = get32 (b + opt + dirofs);
+  if (ndirs > (optsize - dirofs - 4) / 8)
+    ndirs = (optsize - dirofs - 4) / 8;
+  dirs = b + opt + dirofs + 4;
+
+  nsections = get16 (b + pe + 4 + 2);
+  if ((n - opt - optsize) / SECTION_SIZE < nsections)
+    nsections = (n - opt - optsize) / SECTION_SIZE;
+  sections = b + opt + optsize;
+
+  free (imports_);
+  imports_ = NULL;
+  nimports_ = -1;
+  return true;
+}
+
+bool
+pe_image::directory (unsigned idx, uint32_t *rva, uint32_t *size) const
+{
+  if (idx >= ndirs)
+    return false;
+  *rva = get32 (dirs + 8 * idx);
+  *size = get32 (dirs + 8 * idx + 4);
+  return *rva && *size;
+}
+
+/* Map an RVA to its bytes in the file and the number of bytes that follow
+   it in the same section.  Data beyond the raw size of a section is not in
+   the file at all.  */
+const unsigned char *
+pe_image::rva_ptr (uint32_t rva, size_t *avail) const
+{
+  for (unsigned i = 0; i < nsections; i++)
+    {
+      const unsigned char *s = sections + i * SECTION_SIZE;
+      uint32_t vsize = get32 (s + 8);
+      uint32_t va = get32 (s + 12);
+      uint32_t rawsize = get32 (s + 16);
+      uint32_t raw = get32 (s + 20);
+
+      if (rva < va || rva - va >= (vsize > rawsize ? vsize : rawsize))
+	continue;
+      uint32_t ofs = rva - va;
+      if (ofs >= rawsize || raw >= len || ofs >= len - raw)
+	return NULL;
+      *avail = rawsize - ofs;
+      if (*avail > len - raw - ofs)
+	*avail = len - raw - ofs;
+      return base + raw + ofs;
+    }
+  return NULL;
+}
+
+const char *
+pe_image::string (uint32_t rva) const
+{
+  size_t avail;
+  const unsigned char *p = rva_ptr (rva, &avail);
+
+  if (!p || !memchr (p, '\0', avail))
+    return NULL;
+  return (const char *) p;
+}
+
+int
+pe_image::imports (const char *const **names)
+{
+  uint32_t rva, size;
+  size_t avail;
+  const unsigned char *p;
+  int alloc = 0;
+
+  if (nimports_ >= 0)
+    {
+      *names = imports_;
+      return nimports_;
+    }
+
+  nimports_ = 0;
+  if (directory (PE_DIR_IMPORT, &rva, &size)
+      && (p = rva_ptr (rva, &avail)))
+    /* The table ends with an all-zero descriptor; stop at a missing name
+       too, as the loader does.  */
+    for (; avail >= IMPORT_DESC_SIZE && get32 (p + 12);
+	 p += IMPORT_DESC_SIZE, avail -= IMPORT_DESC_SIZE)
+      {
+	const char *name = string (get32 (p + 12));
+
+	if (!name)
+	  continue;
+	if (nimports_ == alloc)
+	  {
+	    alloc = alloc ? 2 * alloc : 16;
+	    const char **n = (const char **)
+			     realloc (imports_, alloc * sizeof *n);
+	    if (!n)
+	      {
+		free (imports_);
+		imports_ = NULL;
+		nimports_ = -1;
+		return -1;
+	      }
+	    imports_ = n;
+	  }
+	imports_[nimports_++] = name;
+      }
+  *names = imports_;
+  return nimports_;
+}
+
+bool
+pe_image::export_info (pe_export *exp) const
+{
+  uint32_t rva, size;
+  size_t avail;
+  const unsigned char *p;
+
+  if (!directory (PE_DIR_EXPORT, &rva, &size)
+      || !(p = rva_ptr (rva, &avail)) || avail < EXPORT_DIR_SIZE)
+    return false;
+  exp->timestamp = get32 (p + 4);
+  exp->major_ver = get16 (p + 8);
+  exp->minor_ver = get16 (p + 10);
+  exp->name = string (get32 (p + 12));
+  return exp->name != NULL;
+}
@@ -0,0 +1,69 @@
+/* pe.h
+
+This file is part of Cygwin.
+
+This software is a copyrighted work licensed under the terms of the
+Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
+details. */
+
+#ifndef _PE_H
+#define _PE_H
+
+/* A reader for PE images held in memory, typically a read-only mapping of
+   the whole file.  It knows just enough of the format to report the
+   machine and version fields and the import and export directories.
+   Every offset is checked against the size of the image, and nothing here
+   needs the Windows headers, so the parser builds and runs on any
+   little-endian host.  The import table is only walked when asked for.  */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PE_DIR_EXPORT	0
+#define PE_DIR_IMPORT	1
+
+struct pe_export
+{
+  const char *name;
+  uint32_t timestamp;
+  uint16_t major_ver;
+  uint16_t minor_ver;
+};
+
+class pe_image
+{
+  const unsigned char *base;
+  size_t len;
+  const unsigned char *sections;
+  unsigned nsections;
+  const unsigned char *dirs;
+  unsigned ndirs;
+  uint16_t machine_;
+  uint16_t versions_[6];
+  const char **imports_;
+  int nimports_;
+
+  const unsigned char *rva_ptr (uint32_t, size_t *) const;
+public:
+  pe_image () : base (NULL), len (0), sections (NULL), nsections (0),
+		dirs (NULL), ndirs (0), machine_ (0), imports_ (NULL),
+		nimports_ (-1) {}
+  ~pe_image ();
+  /* Check the headers of the LEN byte image at P.  The image must stay
+     valid for as long as this object, or the strings it returns, are
+     used.  */
+  bool parse (const void *p, size_t len);
+  uint16_t machine () const { return machine_; }
+  /* OS, image and subsystem version, each as major, minor.  */
+  const uint16_t *versions () const { return versions_; }
+  bool directory (unsigned, uint32_t *, uint32_t *) const;
+  /* The NUL-terminated string at an RVA, or NULL if it runs off the
+     end of its section.  */
+  const char *string (uint32_t) const;
+  /* Set *NAMES to the DLL names in the import directory and return how
+     many there are, or -1 if out of memory.  */
+  int imports (const char *const **names);
+  bool export_info (pe_export *) const;
+};
+
+#endif /*_PE_H*/
@@ -28,15 +28,16 @@ details. */
    table should match the battery of tests below.  */
 
 #if defined(TESTSUITE_MOUNT_TABLE)
-static mnt_t mount_table[] = {
-/* native                 posix               flags                        issys */
- { TESTSUITE_ROOT,        (char*)"/",                MOUNT_BINARY | MOUNT_SYSTEM, 1 },
- { "O:\\other",           (char*)"/otherdir",        MOUNT_BINARY | MOUNT_SYSTEM, 1 },
- { "S:\\some\\dir",       (char*)"/somedir",         MOUNT_BINARY | MOUNT_SYSTEM, 1 },
- { TESTSUITE_ROOT"\\bin", (char*)"/usr/bin",         MOUNT_BINARY | MOUNT_SYSTEM, 1 },
- { TESTSUITE_ROOT"\\lib", (char*)"/usr/lib",         MOUNT_BINARY | MOUNT_SYSTEM, 1 },
- { ".",                   (char*)TESTSUITE_CYGDRIVE, MOUNT_BINARY | MOUNT_SYSTEM | MOUNT_CYGDRIVE, 1 },
- { NULL,                  (char*)NULL,               0,                           0 }
+mnt_t mount_table[255] = {
+/* native                 posix                      flags */
+ { TESTSUITE_ROOT,        (char*)"/",                MOUNT_BINARY | MOUNT_SYSTEM },
+ { "O:\\other",           (char*)"/otherdir",        MOUNT_BINARY | MOUNT_SYSTEM },
+ { "S:\\some\\dir",       (char*)"/somedir",         MOUNT_BINARY | MOUNT_SYSTEM },
+ { "N:\\nested",          (char*)"/otherdir/nested", MOUNT_BINARY | MOUNT_SYSTEM },
+ { TESTSUITE_ROOT"\\bin", (char*)"/usr/bin",         MOUNT_BINARY | MOUNT_SYSTEM },
+ { TESTSUITE_ROOT"\\lib", (char*)"/usr/lib",         MOUNT_BINARY | MOUNT_SYSTEM },
+ { ".",                   (char*)TESTSUITE_CYGDRIVE, MOUNT_BINARY | MOUNT_SYSTEM | MOUNT_CYGDRIVE },
+ { NULL,                  (char*)NULL,               0 }
 };
 
 
@@ -109,6 +110,14 @@ static test_t testsuite_tests[] = {
  { "S:\\some\\dir\\foo",       "file.ext",               "S:\\some\\dir\\foo\\file.ext" },
  { "S:\\some\\dir\\foo",       "./file.ext",             "S:\\some\\dir\\foo\\file.ext" },
  { "S:\\some\\dir\\foo",       "bar/file.ext",           "S:\\some\\dir\\foo\\bar\\file.ext" },
+ { NO_CWD,                     "/otherdir/nested",       "N:\\nested" },
+ { NO_CWD,                     "/otherdir/nested/f.ext", "N:\\nested\\f.ext" },
+ { NO_CWD,                     "/otherdir/nestedx/f.ext", "O:\\other\\nestedx\\f.ext" },
+ { NO_CWD,                     "/OtherDir/Nested/f.ext", "N:\\nested\\f.ext" },
+ { NO_CWD,                     "/otherdirx/file.ext",    TESTSUITE_ROOT"\\otherdirx\\file.ext" },
+ { "N:\\nested",               "file.ext",               "N:\\nested\\file.ext" },
+ { "N:\\nested\\foo",          "bar/file.ext",           "N:\\nested\\foo\\bar\\file.ext" },
+ { "n:\\NESTED",               "file.ext",               "N:\\nested\\file.ext" },
  { NO_CWD,                     "//server/share/foo/bar", "\\\\server\\share\\foo\\bar" },
  { NO_CWD,                     NULL,                     NULL }
 };